@@ -0,0 +1,106 @@
+/**
+ * Coût du bruit de température de la passe climat, avant / après le contexte de bruit partagé
+ *  - avant : initPerm(seed) puis fractalNoise pour chaque tile (ancien Tile::computeClimate)
+ *  - cache : Noise::forSeed(seed) une fois par carte puis fractalNoise pour chaque tile
+ *            (gain du seul contexte partagé, sans le calcul par grille)
+ *  - après : Noise::forSeed(seed) une fois par carte puis fractalNoiseGrid sur toute la carte
+ *
+ * Compilation (tâche "Build benchmark") :
+ *   g++ benchmark/climateBench.cpp utils/Noise.cpp -std=c++20 -O2 -o __exe__/climate_bench.exe
+ */
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+#include "../utils/Noise.hpp"
+
+// mêmes valeurs par défaut que gameParam
+static const unsigned int seed = 54;
+static const int octaves = 3;
+static const float persistence = 1.4f;
+static const float lacunarity = 2.3f;
+static const float frequency = 0.01f;
+
+// nombre de régénérations par taille (comme en déplaçant un slider)
+static const int nbRuns = 20;
+
+static double elapsedMs(std::chrono::high_resolution_clock::time_point start) {
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+int main() {
+    const int sizes[] = {35, 99, 256};
+    float checksum = 0.0f; // empêche le compilateur de supprimer les calculs
+
+    std::printf("%-8s %-8s %16s %16s %16s %10s %10s\n",
+                "taille", "tiles", "avant (ms)", "cache (ms)", "apres (ms)", "gain cache", "gain");
+
+    for (int size : sizes) {
+        // même disposition que HexGrid : lignes impaires décalées d'une demi-case
+        std::vector<float> xs;
+        std::vector<float> ys;
+        for (int row = 0; row < size; ++row) {
+            int cols = (row % 2 == 0) ? size : size - 1;
+            for (int col = 0; col < cols; ++col) {
+                xs.push_back(col + ((row % 2) ? 0.5f : 0.0f));
+                ys.push_back(static_cast<float>(row));
+            }
+        }
+        const size_t nbTiles = xs.size();
+        std::vector<float> out(nbTiles);
+
+        /* ----- avant ----- */
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int run = 0; run < nbRuns; ++run) {
+            Noise perlin;
+            for (size_t i = 0; i < nbTiles; ++i) {
+                perlin.initPerm(seed);
+                out[i] = perlin.fractalNoise(
+                    (xs[i] * frequency) * -1,
+                    (ys[i] * frequency) * -1,
+                    octaves, persistence, lacunarity
+                );
+            }
+            checksum += out[nbTiles / 2];
+        }
+        double before = elapsedMs(start) / nbRuns;
+
+        /* ----- cache seul ----- */
+        start = std::chrono::high_resolution_clock::now();
+        for (int run = 0; run < nbRuns; ++run) {
+            std::shared_ptr<const Noise> noise = Noise::forSeed(seed);
+            for (size_t i = 0; i < nbTiles; ++i) {
+                out[i] = noise->fractalNoise(
+                    (xs[i] * frequency) * -1,
+                    (ys[i] * frequency) * -1,
+                    octaves, persistence, lacunarity
+                );
+            }
+            checksum += out[nbTiles / 2];
+        }
+        double cached = elapsedMs(start) / nbRuns;
+
+        /* ----- après ----- */
+        NoiseParams params;
+        params.frequency = frequency;
+        params.scale = -1.0f;
+        params.octaves = octaves;
+        params.persistence = persistence;
+        params.lacunarity = lacunarity;
+
+        start = std::chrono::high_resolution_clock::now();
+        for (int run = 0; run < nbRuns; ++run) {
+            std::shared_ptr<const Noise> noise = Noise::forSeed(seed);
+            noise->fractalNoiseGrid(xs.data(), ys.data(), out.data(), nbTiles, params);
+            checksum += out[nbTiles / 2];
+        }
+        double after = elapsedMs(start) / nbRuns;
+
+        std::printf("%-8d %-8zu %16.3f %16.3f %16.3f %9.1fx %9.1fx\n",
+                    size, nbTiles, before, cached, after, before / cached, before / after);
+    }
+
+    std::printf("(checksum %f)\n", checksum);
+    return 0;
+}
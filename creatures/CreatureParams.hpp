@@ -0,0 +1,31 @@
+#pragma once
+
+#include "../gameParam.hpp"
+
+/**
+ * Copie des paramètres de gameParam utilisés par la simulation des créatures,
+ * prise une fois par tick : les passes parallèles ne lisent pas les globales.
+ */
+struct CreatureParams {
+    float hunger_rate;
+    float thirst_rate;
+    float love_rate;
+    float perception_cost;
+    int maturity_age;
+    float mutation_chance;
+    float mutation_amount;
+
+    bool operator==(const CreatureParams& other) const = default;
+
+    static CreatureParams current() {
+        CreatureParams p;
+        p.hunger_rate = gameParam::hunger_rate;
+        p.thirst_rate = gameParam::thirst_rate;
+        p.love_rate = gameParam::love_rate;
+        p.perception_cost = gameParam::perception_cost;
+        p.maturity_age = gameParam::maturity_age;
+        p.mutation_chance = gameParam::mutation_chance;
+        p.mutation_amount = gameParam::mutation_amount;
+        return p;
+    }
+};
@@ -0,0 +1,191 @@
+#include "CreatureStore.hpp"
+
+#include <cassert>
+#include <type_traits>
+
+void CreatureStore::reserve(int nbCreatures) {
+    for (auto& column : traits) column.reserve(nbCreatures);
+    for (auto& column : drives) column.reserve(nbCreatures);
+    tile.reserve(nbCreatures);
+    age.reserve(nbCreatures);
+    id.reserve(nbCreatures);
+    slotOf.reserve(nbCreatures);
+
+    slotIndex.reserve(nbCreatures);
+    slotGeneration.reserve(nbCreatures);
+}
+
+void CreatureStore::clear() {
+    // les générations sont gardées : les handles d'avant le clear restent invalides
+    for (uint32_t slot : slotOf) {
+        slotGeneration[slot]++;
+    }
+    // chaînés à l'envers : les slots sont repris dans l'ordre croissant
+    freeHead = CreatureHandle::NONE;
+    for (uint32_t slot = static_cast<uint32_t>(slotIndex.size()); slot-- > 0;) {
+        slotIndex[slot] = freeHead;
+        freeHead = slot;
+    }
+    resizeColumns(0);
+    nextId = 0;
+}
+
+template <typename Self, typename F>
+void CreatureStore::forEachColumn(Self& self, F&& f) {
+    static_assert(sizeof(float) == 4 && sizeof(int) == 4, "colonnes de 4 octets");
+    for (auto& column : self.traits) f(column);
+    for (auto& column : self.drives) f(column);
+    f(self.tile);
+    f(self.age);
+    f(self.id);
+    f(self.slotOf);
+}
+
+void CreatureStore::resizeColumns(int nbCreatures) {
+    forEachColumn(*this, [&](auto& column) { column.resize(nbCreatures); });
+}
+
+uint32_t CreatureStore::takeSlot(int index) {
+    uint32_t slot;
+    if (freeHead != CreatureHandle::NONE) {
+        slot = freeHead;
+        freeHead = slotIndex[slot];
+    } else {
+        slot = static_cast<uint32_t>(slotIndex.size());
+        slotIndex.push_back(0);
+        slotGeneration.push_back(0);
+    }
+    slotIndex[slot] = static_cast<uint32_t>(index);
+    slotOf[index] = slot;
+    return slot;
+}
+
+void CreatureStore::releaseSlot(uint32_t slot) {
+    slotGeneration[slot]++;
+    slotIndex[slot] = freeHead;
+    freeHead = slot;
+}
+
+void CreatureStore::moveCreature(int from, int to) {
+    for (auto& column : traits) column[to] = column[from];
+    for (auto& column : drives) column[to] = column[from];
+    tile[to] = tile[from];
+    age[to] = age[from];
+    id[to] = id[from];
+    slotOf[to] = slotOf[from];
+    slotIndex[slotOf[to]] = static_cast<uint32_t>(to);
+}
+
+CreatureHandle CreatureStore::spawn(const CreatureTraits& newTraits, int newTile) {
+    int index = spawnBulk(std::span<const CreatureTraits>(&newTraits, 1), std::span<const int>(&newTile, 1));
+    return handleAt(index);
+}
+
+int CreatureStore::spawnBulk(std::span<const CreatureTraits> newTraits, std::span<const int> newTiles) {
+    assert(newTraits.size() == newTiles.size());
+
+    const int first = count();
+    const int nbNew = static_cast<int>(newTraits.size());
+    resizeColumns(first + nbNew); // besoins et âge remis à 0 par resize
+
+    // colonne par colonne : écritures contiguës
+    for (int t = 0; t < TRAIT_COUNT; ++t) {
+        float* column = traits[t].data() + first;
+        for (int i = 0; i < nbNew; ++i) {
+            column[i] = newTraits[i].values[t];
+        }
+    }
+    for (int i = 0; i < nbNew; ++i) {
+        tile[first + i] = newTiles[i];
+        id[first + i] = nextId++;
+        takeSlot(first + i);
+    }
+    return first;
+}
+
+bool CreatureStore::remove(CreatureHandle handle) {
+    int index = indexOf(handle);
+    if (index < 0) return false;
+    removeAt(index);
+    return true;
+}
+
+void CreatureStore::removeAt(int index) {
+    const int last = count() - 1;
+    releaseSlot(slotOf[index]);
+    if (index != last) moveCreature(last, index);
+    resizeColumns(last);
+}
+
+void CreatureStore::compact(std::span<const int> deadIndices) {
+    const int nbDead = static_cast<int>(deadIndices.size());
+    if (nbDead == 0) return;
+    const int newCount = count() - nbDead;
+
+    for (int index : deadIndices) releaseSlot(slotOf[index]);
+
+    // trous sous newCount dans l'ordre croissant, survivantes au-delà dans l'ordre décroissant :
+    // il y a exactement autant des uns que des autres
+    int source = count() - 1;
+    int deadTail = nbDead - 1;
+    for (int k = 0; k < nbDead && deadIndices[k] < newCount; ++k) {
+        while (deadTail >= 0 && deadIndices[deadTail] == source) {
+            --deadTail;
+            --source;
+        }
+        moveCreature(source--, deadIndices[k]);
+    }
+    resizeColumns(newCount);
+}
+
+bool CreatureStore::alive(CreatureHandle handle) const {
+    return indexOf(handle) >= 0;
+}
+
+int CreatureStore::indexOf(CreatureHandle handle) const {
+    if (handle.slot >= slotGeneration.size() || slotGeneration[handle.slot] != handle.generation) return -1;
+    // slot libre : sa génération a déjà été incrémentée à la mort, le test ci-dessus suffit
+    return static_cast<int>(slotIndex[handle.slot]);
+}
+
+CreatureHandle CreatureStore::handleAt(int index) const {
+    uint32_t slot = slotOf[index];
+    return CreatureHandle{slot, slotGeneration[slot]};
+}
+
+CreatureStore::SavedState CreatureStore::savedState() const {
+    SavedState state;
+    state.count = count();
+    state.nbSlots = static_cast<int>(slotIndex.size());
+    state.freeHead = freeHead;
+    state.nextId = nextId;
+
+    int c = 0;
+    forEachColumn(*this, [&](const auto& column) { state.columns[c++] = column.data(); });
+    state.slotIndex = slotIndex.data();
+    state.slotGeneration = slotGeneration.data();
+    return state;
+}
+
+void CreatureStore::restore(const SavedState& state) {
+    int c = 0;
+    forEachColumn(*this, [&](auto& column) {
+        using Value = std::remove_reference_t<decltype(column[0])>;
+        column.assign(static_cast<const Value*>(state.columns[c++]), state.count);
+    });
+
+    slotIndex.assign(state.slotIndex, state.slotIndex + state.nbSlots);
+    slotGeneration.assign(state.slotGeneration, state.slotGeneration + state.nbSlots);
+    freeHead = state.freeHead;
+    nextId = state.nextId;
+}
+
+CreatureTraits CreatureStore::traitsAt(int index) const {
+    CreatureTraits result;
+    for (int t = 0; t < TRAIT_COUNT; ++t) result.values[t] = traits[t][index];
+    return result;
+}
+
+void CreatureStore::setTraits(int index, const CreatureTraits& newTraits) {
+    for (int t = 0; t < TRAIT_COUNT; ++t) traits[t][index] = newTraits.values[t];
+}
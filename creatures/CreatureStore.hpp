@@ -0,0 +1,152 @@
+#pragma once
+
+#ifndef CREATURESTORE_HPP
+#define CREATURESTORE_HPP
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#include "../utils/AlignedArray.hpp"
+
+// caractéristiques héritées, modifiables par les mutations (__consigne__.txt)
+enum class Trait {
+    Size,
+    Speed,
+    Reproduction,
+    Diet,       // -99 (plantfood) .. 99 (viande)
+    Stealth,
+    Perception,
+    Count
+};
+
+// besoins qui fixent la priorité d'une créature, de 0 (satisfait) à 1 (urgent)
+enum class Drive {
+    Hunger,
+    Thirst,
+    Love,
+    Count
+};
+
+inline constexpr int TRAIT_COUNT = static_cast<int>(Trait::Count);
+inline constexpr int DRIVE_COUNT = static_cast<int>(Drive::Count);
+
+// valeurs d'une créature, pour les naissances et la lecture ponctuelle
+struct CreatureTraits {
+    float values[TRAIT_COUNT] = {1.0f, 1.0f, 1.0f, 0.0f, 1.0f, 1.0f};
+
+    float& operator[](Trait t) { return values[static_cast<int>(t)]; }
+    float operator[](Trait t) const { return values[static_cast<int>(t)]; }
+};
+
+/**
+ * Référence stable vers une créature.
+ * L'index dense d'une créature change quand une autre meurt (swap-remove), pas son slot :
+ * le handle passe par le slot et la génération du slot, incrémentée à chaque mort,
+ * indique qu'un ancien handle ne désigne plus personne.
+ */
+struct CreatureHandle {
+    static constexpr uint32_t NONE = 0xFFFFFFFFu;
+
+    uint32_t slot = NONE;
+    uint32_t generation = 0;
+
+    bool operator==(const CreatureHandle&) const = default;
+};
+
+/**
+ * Population de créatures en structure de tableaux : un tableau contigu et aligné par
+ * caractéristique et par besoin, indexé de 0 à count() - 1 sans trou.
+ * Les passes sur toute la population (creatureSystems) lisent ces tableaux en continu.
+ * Une mort déplace la dernière créature à la place libérée (swap-remove) : l'ordre des
+ * index n'est pas stable, les références qui doivent durer passent par CreatureHandle.
+ * Les slots libérés sont chaînés entre eux (liste libre dans slotIndex) et repris par les
+ * naissances : une fois la capacité atteinte, morts et naissances n'allouent plus rien.
+ */
+class CreatureStore {
+public:
+    int count() const { return static_cast<int>(slotOf.size()); }
+    bool empty() const { return slotOf.empty(); }
+
+    // prévoit la place pour nbCreatures sans réallocation
+    void reserve(int nbCreatures);
+    void clear();
+
+    CreatureHandle spawn(const CreatureTraits& traits, int tile);
+    /**
+     * Naissances en bloc (traits.size() == tiles.size()) : les nouvelles créatures occupent
+     * les index [retour, count()) et leurs besoins partent de 0
+     */
+    int spawnBulk(std::span<const CreatureTraits> traits, std::span<const int> tiles);
+
+    // false si le handle ne désigne plus une créature vivante
+    bool remove(CreatureHandle handle);
+    void removeAt(int index);
+    /**
+     * Morts d'un tick en un seul passage (index triés par ordre croissant, sans doublon) :
+     * les trous sous la nouvelle taille sont bouchés par les survivantes de la fin
+     */
+    void compact(std::span<const int> deadIndices);
+
+    bool alive(CreatureHandle handle) const;
+    // index dense actuel, -1 si la créature est morte
+    int indexOf(CreatureHandle handle) const;
+    CreatureHandle handleAt(int index) const;
+
+    CreatureTraits traitsAt(int index) const;
+    void setTraits(int index, const CreatureTraits& traits);
+
+    // tableaux denses (count() valeurs), à ne pas redimensionner de l'extérieur
+    float* trait(Trait t) { return traits[static_cast<int>(t)].data(); }
+    const float* trait(Trait t) const { return traits[static_cast<int>(t)].data(); }
+    float* drive(Drive d) { return drives[static_cast<int>(d)].data(); }
+    const float* drive(Drive d) const { return drives[static_cast<int>(d)].data(); }
+    int* tiles() { return tile.data(); }
+    const int* tiles() const { return tile.data(); }
+    int* ages() { return age.data(); }
+    const int* ages() const { return age.data(); }
+    // identifiant unique (jamais réutilisé avant clear), clé des tirages aléatoires de la créature
+    const uint32_t* ids() const { return id.data(); }
+
+    /**
+     * État complet pour les snapshots : SAVED_COLUMNS colonnes de count valeurs de 4 octets
+     * (caractéristiques, besoins, tile, âge, id, slot) puis la table des slots
+     */
+    static constexpr int SAVED_COLUMNS = TRAIT_COUNT + DRIVE_COUNT + 4;
+    struct SavedState {
+        int count = 0;
+        int nbSlots = 0;
+        uint32_t freeHead = CreatureHandle::NONE;
+        uint32_t nextId = 0;
+        const void* columns[SAVED_COLUMNS] = {};
+        const uint32_t* slotIndex = nullptr;
+        const uint32_t* slotGeneration = nullptr;
+    };
+    SavedState savedState() const;
+    // remplace tout le contenu (les tableaux de state sont copiés)
+    void restore(const SavedState& state);
+
+private:
+    AlignedArray<float> traits[TRAIT_COUNT];
+    AlignedArray<float> drives[DRIVE_COUNT];
+    AlignedArray<int> tile;    // index de la tile occupée dans la HexGrid
+    AlignedArray<int> age;     // en ticks
+    AlignedArray<uint32_t> id;
+    AlignedArray<uint32_t> slotOf;  // slot de chaque index dense
+
+    // table des slots (indexée par CreatureHandle::slot)
+    std::vector<uint32_t> slotIndex;       // index dense de la créature du slot, slot libre suivant si libre
+    std::vector<uint32_t> slotGeneration;
+    uint32_t freeHead = CreatureHandle::NONE;
+    uint32_t nextId = 0;
+
+    void resizeColumns(int nbCreatures);
+    // colonnes dans l'ordre de SavedState::columns (self : store const ou non)
+    template <typename Self, typename F> static void forEachColumn(Self& self, F&& f);
+    uint32_t takeSlot(int index);
+    void releaseSlot(uint32_t slot);
+    // copie la créature from à la place to (from est ensuite abandonnée)
+    void moveCreature(int from, int to);
+};
+
+#endif // CREATURESTORE_HPP
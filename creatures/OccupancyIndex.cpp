@@ -0,0 +1,55 @@
+#include "OccupancyIndex.hpp"
+
+#include <algorithm>
+
+void OccupancyIndex::build(const CreatureStore& store, int nbTiles) {
+    const int nbCreatures = store.count();
+    const int nbBuckets = nbTiles * DIET_GROUP_COUNT;
+    const int* tile = store.tiles();
+    const float* diet = store.trait(Trait::Diet);
+
+    tiles = nbTiles;
+    // tailles gardées d'un tick à l'autre : pas de réallocation tant que la population ne grossit pas
+    bucketStart.assign(nbBuckets + 1, 0);
+    sorted.resize(nbCreatures);
+    bucketOf.resize(nbCreatures);
+
+    // comptage (décalé d'une case : bucketStart[b + 1] = taille du groupe b)
+    for (int i = 0; i < nbCreatures; ++i) {
+        int bucket = tile[i] * DIET_GROUP_COUNT + static_cast<int>(dietGroup(diet[i]));
+        bucketOf[i] = bucket;
+        bucketStart[bucket + 1]++;
+    }
+
+    // sommes préfixes : bucketStart[b] = début du groupe b
+    for (int b = 0; b < nbBuckets; ++b) {
+        bucketStart[b + 1] += bucketStart[b];
+    }
+
+    // rangement dans l'ordre des index, bucketStart[b] sert de curseur puis est décalé d'une case
+    for (int i = 0; i < nbCreatures; ++i) {
+        sorted[bucketStart[bucketOf[i]]++] = i;
+    }
+    std::copy_backward(bucketStart.begin(), bucketStart.end() - 1, bucketStart.end());
+    bucketStart[0] = 0;
+}
+
+NeighborOccupants OccupancyIndex::onNeighbors(const HexGrid& grid, int tile) const {
+    NeighborOccupants result;
+    for (int n : grid.neighborIndices(tile)) {
+        if (n != HexGrid::NO_NEIGHBOR) {
+            result.ranges[result.count++] = onTile(n);
+        }
+    }
+    return result;
+}
+
+NeighborOccupants OccupancyIndex::onNeighbors(const HexGrid& grid, int tile, DietGroup group) const {
+    NeighborOccupants result;
+    for (int n : grid.neighborIndices(tile)) {
+        if (n != HexGrid::NO_NEIGHBOR) {
+            result.ranges[result.count++] = onTile(n, group);
+        }
+    }
+    return result;
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#ifndef OCCUPANCYINDEX_HPP
+#define OCCUPANCYINDEX_HPP
+
+#include <array>
+#include <span>
+#include <vector>
+
+#include "CreatureStore.hpp"
+#include "../environment/HexGrid.hpp"
+
+// régime d'une créature pour les requêtes (proies, prédateurs, partenaires)
+enum class DietGroup {
+    Herbivore,  // régime < -33
+    Omnivore,
+    Carnivore,  // régime > 33
+    Count
+};
+
+inline constexpr int DIET_GROUP_COUNT = static_cast<int>(DietGroup::Count);
+
+inline DietGroup dietGroup(float diet) {
+    if (diet < -33.0f) return DietGroup::Herbivore;
+    if (diet > 33.0f) return DietGroup::Carnivore;
+    return DietGroup::Omnivore;
+}
+
+/**
+ * Créatures des voisins d'une tile sans allocation : au plus 6 plages d'index denses,
+ * parcourables avec un range-for (une plage par voisin)
+ */
+struct NeighborOccupants {
+    std::array<std::span<const int>, 6> ranges{};
+    int count = 0;
+
+    const std::span<const int>* begin() const { return ranges.data(); }
+    const std::span<const int>* end() const { return ranges.data() + count; }
+    int size() const { return count; }
+};
+
+/**
+ * Index des créatures par tile, reconstruit à chaque tick par un tri par comptage :
+ * les index denses de CreatureStore sont rangés par (tile, DietGroup), dans l'ordre des
+ * index à l'intérieur d'un même groupe (le résultat ne dépend que de la population).
+ * Les créatures d'une tile, ou d'une tile et d'un régime, forment une plage contiguë.
+ * L'index n'est plus valable dès qu'une créature naît, meurt ou change de tile.
+ */
+class OccupancyIndex {
+public:
+    void build(const CreatureStore& store, int nbTiles);
+
+    int nbTiles() const { return tiles; }
+
+    // index denses des créatures de la tile
+    std::span<const int> onTile(int tile) const { return range(tile * DIET_GROUP_COUNT, (tile + 1) * DIET_GROUP_COUNT); }
+    std::span<const int> onTile(int tile, DietGroup group) const {
+        int bucket = tile * DIET_GROUP_COUNT + static_cast<int>(group);
+        return range(bucket, bucket + 1);
+    }
+    int countOnTile(int tile) const { return static_cast<int>(onTile(tile).size()); }
+
+    // créatures des tiles voisines de tile (dans l'ordre de hexNeighbors)
+    NeighborOccupants onNeighbors(const HexGrid& grid, int tile) const;
+    NeighborOccupants onNeighbors(const HexGrid& grid, int tile, DietGroup group) const;
+
+private:
+    int tiles = 0;
+    std::vector<int> bucketStart;    // début de chaque (tile, régime), + la fin en dernière case
+    std::vector<int> sorted;         // index denses triés par (tile, régime)
+    std::vector<int> bucketOf;       // (tile, régime) de chaque créature, calculé au premier passage
+
+    std::span<const int> range(int firstBucket, int endBucket) const {
+        return std::span<const int>(sorted.data() + bucketStart[firstBucket], sorted.data() + bucketStart[endBucket]);
+    }
+};
+
+#endif // OCCUPANCYINDEX_HPP
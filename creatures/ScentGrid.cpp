@@ -0,0 +1,64 @@
+#include "ScentGrid.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+void ScentGrid::resize(int nbTiles, float lifetime) {
+    tiles.assign(nbTiles, TileScents{});
+    decayPerTick = (lifetime > 0.0f) ? 1.0f / lifetime : 1.0f;
+}
+
+void ScentGrid::clear() {
+    std::fill(tiles.begin(), tiles.end(), TileScents{});
+}
+
+void ScentGrid::restore(int nbTiles, const ScentSlot* slots) {
+    static_assert(sizeof(TileScents) == SLOTS * sizeof(ScentSlot), "emplacements contigus d'une tile à l'autre");
+    tiles.resize(nbTiles);
+    if (nbTiles) std::memcpy(static_cast<void*>(tiles.data()), slots, nbTiles * sizeof(TileScents));
+}
+
+void ScentGrid::deposit(int tile, int channel, float amount, uint32_t now) {
+    ScentSlot* slots = tiles[tile].slots;
+
+    // même canal : on repart de la force actuelle
+    // sinon emplacement vide, ou à défaut celui dont l'odeur est la plus faible
+    ScentSlot* target = nullptr;
+    float weakest = 0.0f;
+    for (int s = 0; s < SLOTS; ++s) {
+        if (slots[s].channel == channel) {
+            slots[s].strength = current(slots[s], now) + amount;
+            slots[s].tick = now;
+            return;
+        }
+
+        float value = (slots[s].channel == ScentSlot::EMPTY) ? -1.0f : current(slots[s], now);
+        if (!target || value < weakest) {
+            target = &slots[s];
+            weakest = value;
+        }
+    }
+
+    *target = ScentSlot{channel, now, amount};
+}
+
+float ScentGrid::strength(int tile, int channel, uint32_t now) const {
+    for (const ScentSlot& slot : tiles[tile].slots) {
+        if (slot.channel == channel) return current(slot, now);
+    }
+    return 0.0f;
+}
+
+ScentTrace ScentGrid::strongestNeighbor(const HexGrid& grid, int tile, int channel, uint32_t now) const {
+    ScentTrace best;
+    for (int n : grid.neighborIndices(tile)) {
+        if (n == HexGrid::NO_NEIGHBOR) continue;
+
+        float value = strength(n, channel, now);
+        if (value > best.strength) {
+            best.tile = n;
+            best.strength = value;
+        }
+    }
+    return best;
+}
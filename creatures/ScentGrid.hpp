@@ -0,0 +1,71 @@
+#pragma once
+
+#ifndef SCENTGRID_HPP
+#define SCENTGRID_HPP
+
+#include <cstdint>
+#include <vector>
+
+#include "../environment/HexGrid.hpp"
+
+// odeur d'un canal sur une tile, telle que déposée (la décroissance est calculée à la lecture)
+struct ScentSlot {
+    static constexpr int EMPTY = -1;
+
+    int channel = EMPTY;
+    uint32_t tick = 0;      // tick du dernier dépôt
+    float strength = 0.0f;  // force au moment du dépôt
+};
+
+// voisin le plus odorant pour un canal
+struct ScentTrace {
+    int tile = HexGrid::NO_NEIGHBOR;
+    float strength = 0.0f;
+};
+
+/**
+ * Traces d'odeur laissées par les créatures qui se déplacent, suivies par les prédateurs
+ * et les partenaires (un canal par groupe de créatures : régime, espèce...).
+ * Rien n'est parcouru à chaque tick : une odeur garde le tick et la force de son dernier
+ * dépôt et perd decayPerTick par tick écoulé, calculé quand elle est lue.
+ * Chaque tile a SLOTS emplacements : la mémoire ne dépend pas du nombre de canaux, une
+ * tile qui reçoit un canal de plus oublie l'odeur la plus faible.
+ */
+class ScentGrid {
+public:
+    static constexpr int SLOTS = 4;
+
+    // lifetime : nombre de ticks pour qu'un dépôt de force 1 disparaisse
+    void resize(int nbTiles, float lifetime);
+    void clear();
+
+    void deposit(int tile, int channel, float amount, uint32_t now);
+    float strength(int tile, int channel, uint32_t now) const;
+
+    /**
+     * Voisin de tile où l'odeur du canal est la plus forte (premier dans l'ordre de
+     * hexNeighbors en cas d'égalité), tile == NO_NEIGHBOR si aucun voisin n'en a
+     */
+    ScentTrace strongestNeighbor(const HexGrid& grid, int tile, int channel, uint32_t now) const;
+
+    // snapshots : SLOTS emplacements par tile, tile par tile
+    int count() const { return static_cast<int>(tiles.size()); }
+    const ScentSlot* savedSlots() const { return tiles.empty() ? nullptr : tiles[0].slots; }
+    // garde la durée de vie donnée au dernier resize
+    void restore(int nbTiles, const ScentSlot* slots);
+
+private:
+    struct TileScents {
+        ScentSlot slots[SLOTS];
+    };
+
+    std::vector<TileScents> tiles;
+    float decayPerTick = 0.1f;
+
+    float current(const ScentSlot& slot, uint32_t now) const {
+        float value = slot.strength - decayPerTick * static_cast<float>(now - slot.tick);
+        return (value > 0.0f) ? value : 0.0f;
+    }
+};
+
+#endif // SCENTGRID_HPP
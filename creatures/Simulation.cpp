@@ -0,0 +1,390 @@
+#include "Simulation.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <utility>
+
+#include "creatureSystems.hpp"
+#include "../utils/Philox.hpp"
+
+// tailles de blocs fixes : même découpage quel que soit le nombre de threads
+static const int creaturesPerBlock = 4096;
+static const int tilesPerBlock = 64;          // act : coût selon le nombre d'occupants
+static const int tilesPerUpdateBlock = 1024;   // pousse des ressources : coût fixe par tile
+
+// en dessous, un besoin ne pousse pas à agir
+static constexpr float DRIVE_THRESHOLD = 0.2f;
+// quantité de ressource qui fait passer un besoin de 1 à 0 (la viande nourrit trois fois plus)
+static constexpr float PLANT_PER_HUNGER = 30.0f;
+static constexpr float MEAT_PER_HUNGER = 10.0f;
+static constexpr float WATER_PER_THIRST = 20.0f;
+static constexpr float MEAT_PER_SIZE = 20.0f;  // viande laissée par une créature morte
+static constexpr float BIRTH_COST = 0.2f;      // faim ajoutée à chaque parent
+static constexpr float SCENT_DEPOSIT = 1.0f;
+
+Simulation::Simulation(int nbThreads) : pool(std::make_unique<ThreadPool>(nbThreads)) {}
+
+void Simulation::reset(const HexGrid& map, const std::vector<int>& distToWater, int nbCreatures, uint32_t seed) {
+    grid = map;
+    fields.build(grid, distToWater, ResourceParams::current());
+    scents.resize(grid.count(), gameParam::scent_lifetime);
+    params = CreatureParams::current();
+    this->seed = seed;
+    tickCount = 0;
+    store.clear();
+
+    std::vector<int> land;
+    for (const Tile& tile : grid) {
+        if (!tile.isWater) land.push_back(tile.index);
+    }
+    if (land.empty() || nbCreatures <= 0) return;
+
+    // population de départ : caractéristiques de référence, puis régime, tile et âge tirés
+    // au hasard (âges étalés : toute la population n'atteint pas la maturité au même tick)
+    newTraits.assign(nbCreatures, CreatureTraits{});
+    newTiles.assign(nbCreatures, land[0]);
+    store.reserve(nbCreatures);
+    deaths.reserve(nbCreatures);
+    hunts.reserve(nbCreatures);
+    store.spawnBulk(newTraits, newTiles);
+
+    for (auto& draws : randomDraws) draws.resize(nbCreatures);
+    float* const outputs[] = {randomDraws[0].data(), randomDraws[1].data(), randomDraws[2].data()};
+    rng::uniformBatch(seed, store.ids(), nbCreatures, 0, rng::Purpose::Spawn, outputs, 3);
+
+    float* diet = store.trait(Trait::Diet);
+    int* tile = store.tiles();
+    int* age = store.ages();
+    for (int i = 0; i < nbCreatures; ++i) {
+        diet[i] = -99.0f + 198.0f * outputs[0][i];
+        int pick = static_cast<int>(outputs[1][i] * land.size());
+        tile[i] = land[std::min(pick, static_cast<int>(land.size()) - 1)];
+        age[i] = static_cast<int>(outputs[2][i] * params.maturity_age);
+    }
+}
+
+void Simulation::restore(HexGrid&& map, ResourceFields&& resources, ScentGrid&& scentGrid, CreatureStore&& creatures,
+                         uint32_t seed, uint32_t tick) {
+    grid = std::move(map);
+    fields = std::move(resources);
+    scents = std::move(scentGrid);
+    store = std::move(creatures);
+    params = CreatureParams::current();
+    this->seed = seed;
+    tickCount = tick;
+
+    // mêmes réserves qu'après reset
+    deaths.reserve(store.count());
+    hunts.reserve(store.count());
+    newTraits.reserve(store.count());
+    newTiles.reserve(store.count());
+    for (auto& draws : randomDraws) draws.reserve(store.count());
+}
+
+void Simulation::tick() {
+    params = CreatureParams::current();
+
+    /* ----- ressources et besoins ----- */
+    pool->parallelFor(fields.count(), tilesPerUpdateBlock, [&](int begin, int end) {
+        fields.update(begin, end);
+    });
+    pool->parallelFor(store.count(), creaturesPerBlock, [&](int begin, int end) {
+        creatureSystems::updateDrives(store, begin, end, params);
+    });
+
+    /* ----- sense / decide ----- */
+    occupancy.build(store, grid.count());
+    actions.resize(store.count());
+    targets.resize(store.count());
+    dietRolls.resize(store.count());
+    pool->parallelFor(store.count(), creaturesPerBlock, [&](int begin, int end) {
+        float* const outputs[] = {dietRolls.data() + begin};
+        rng::uniformBatch(seed, store.ids() + begin, end - begin, tickCount, rng::Purpose::DietRoll, outputs, 1);
+        decide(begin, end);
+    });
+
+    /* ----- chasses ----- */
+    // rassemblées dans l'ordre de l'index puis résolues ensemble (un chasseur par ligne)
+    hunts.clear();
+    for (int i = 0; i < store.count(); ++i) {
+        if (static_cast<Action>(actions[i]) == Action::Hunt) hunts.add(i, targets[i]);
+    }
+    huntResults.resize(store.count());
+    pool->parallelFor(hunts.size(), creaturesPerBlock, [&](int begin, int end) {
+        encounters::resolve(store, hunts, begin, end, seed, tickCount);
+        for (int k = begin; k < end; ++k) huntResults[hunts.predators[k]] = hunts.results[k];
+    });
+
+    /* ----- act ----- */
+    dead.resize(store.count());
+    mates.resize(store.count());
+    std::fill(dead.begin(), dead.end(), uint8_t{0});
+    std::fill(mates.begin(), mates.end(), -1);
+    pool->parallelFor(grid.count(), tilesPerBlock, [&](int begin, int end) {
+        act(begin, end);
+    });
+
+    applyDeathsAndBirths();
+    tickCount++;
+}
+
+// voisin où la valeur est la plus grande (> 0), NO_NEIGHBOR s'il n'y en a pas
+static int richestNeighbor(const HexGrid& grid, int tile, const float* values) {
+    int best = HexGrid::NO_NEIGHBOR;
+    float bestValue = 0.0f;
+    for (int n : grid.neighborIndices(tile)) {
+        if (n != HexGrid::NO_NEIGHBOR && values[n] > bestValue) {
+            best = n;
+            bestValue = values[n];
+        }
+    }
+    return best;
+}
+
+/**
+ * Proie d'un chasseur sur sa tile : herbivore ou omnivore d'une taille au plus
+ * captureLimit fois la sienne. La recherche part d'une position tirée (roll) pour que les
+ * chasseurs d'une même tile ne visent pas tous la même proie. -1 s'il n'y en a pas.
+ */
+int Simulation::findPrey(int hunter, float roll) const {
+    const float* size = store.trait(Trait::Size);
+    const float* diet = store.trait(Trait::Diet);
+    const int t = store.tiles()[hunter];
+    const float limit = size[hunter] * encounters::captureLimit(diet[hunter]);
+
+    std::span<const int> herbivores = occupancy.onTile(t, DietGroup::Herbivore);
+    std::span<const int> omnivores = occupancy.onTile(t, DietGroup::Omnivore);
+    const int nbHerbivores = static_cast<int>(herbivores.size());
+    const int total = nbHerbivores + static_cast<int>(omnivores.size());
+    if (total == 0) return -1;
+
+    const int start = std::min(static_cast<int>(roll * total), total - 1);
+    for (int k = 0; k < total; ++k) {
+        const int j = (start + k) % total;
+        const int c = j < nbHerbivores ? herbivores[j] : omnivores[j - nbHerbivores];
+        if (c != hunter && size[c] <= limit) return c;
+    }
+    return -1;
+}
+
+void Simulation::decide(int begin, int end) {
+    const float* hunger = store.drive(Drive::Hunger);
+    const float* thirst = store.drive(Drive::Thirst);
+    const float* love = store.drive(Drive::Love);
+    const float* diet = store.trait(Trait::Diet);
+    const int* tile = store.tiles();
+    const float* plant = fields.field(Resource::Plantfood);
+    const float* meat = fields.field(Resource::Meat);
+    const float* water = fields.field(Resource::Water);
+
+    for (int i = begin; i < end; ++i) {
+        const int t = tile[i];
+        const float h = hunger[i];
+        const float w = thirst[i];
+        const float l = love[i];
+
+        Action action = Action::Rest;
+        int target = HexGrid::NO_NEIGHBOR;
+
+        // priorité au besoin le plus fort (soif, puis faim, puis amour en cas d'égalité)
+        if (w >= h && w >= l && w > DRIVE_THRESHOLD) {
+            if (water[t] > 0.0f) action = Action::Drink;
+            else target = richestNeighbor(grid, t, water);
+        }
+        else if (h >= l && h > DRIVE_THRESHOLD) {
+            // régime > 0 : la viande d'abord, sinon les plantes d'abord
+            const bool meatFirst = diet[i] > 0.0f;
+            const float* first = meatFirst ? meat : plant;
+            const float* second = meatFirst ? plant : meat;
+            // dé à 99 faces : avec un résultat >= |régime| la créature cherche sa nourriture
+            // préférée à côté, sinon elle se contente de l'autre (__consigne__.txt)
+            const int roll = 1 + static_cast<int>(dietRolls[i] * 99.0f);
+            const bool searchPreferred = roll >= static_cast<int>(std::abs(diet[i]));
+
+            int prey = -1;
+            if (first[t] > 0.0f) action = meatFirst ? Action::EatMeat : Action::EatPlant;
+            else if (meatFirst && (prey = findPrey(i, dietRolls[i])) >= 0) {
+                // pas de viande sur la tile : on chasse avant de chercher ailleurs
+                action = Action::Hunt;
+                target = prey;
+            }
+            else {
+                if (searchPreferred) target = richestNeighbor(grid, t, first);
+                if (target == HexGrid::NO_NEIGHBOR && second[t] > 0.0f) {
+                    action = meatFirst ? Action::EatPlant : Action::EatMeat;
+                }
+                else if (target == HexGrid::NO_NEIGHBOR) {
+                    // tile vide : on part vers la nourriture, un carnivore suit sinon l'odeur des herbivores
+                    target = richestNeighbor(grid, t, first);
+                    if (target == HexGrid::NO_NEIGHBOR) target = richestNeighbor(grid, t, second);
+                    if (target == HexGrid::NO_NEIGHBOR && meatFirst) {
+                        target = scents.strongestNeighbor(grid, t, static_cast<int>(DietGroup::Herbivore), tickCount).tile;
+                    }
+                }
+            }
+        }
+        else if (l > DRIVE_THRESHOLD) {
+            // l'amour ne monte qu'après la maturité : l > 0 suffit
+            const DietGroup group = dietGroup(diet[i]);
+            if (occupancy.onTile(t, group).size() > 1) action = Action::Mate;
+            else target = scents.strongestNeighbor(grid, t, static_cast<int>(group), tickCount).tile;
+        }
+
+        if (action == Action::Rest && target != HexGrid::NO_NEIGHBOR) action = Action::Move;
+        actions[i] = static_cast<uint8_t>(action);
+        targets[i] = target;
+    }
+}
+
+void Simulation::act(int firstTile, int lastTile) {
+    float* hunger = store.drive(Drive::Hunger);
+    float* thirst = store.drive(Drive::Thirst);
+    float* love = store.drive(Drive::Love);
+    const float* diet = store.trait(Trait::Diet);
+    const float* size = store.trait(Trait::Size);
+    int* tile = store.tiles();
+    float* plant = fields.field(Resource::Plantfood);
+    float* meat = fields.field(Resource::Meat);
+    float* water = fields.field(Resource::Water);
+
+    // le bloc ne modifie que ses tiles et les créatures qui s'y trouvaient au début du tick
+    for (int t = firstTile; t < lastTile; ++t) {
+        int waitingMate[DIET_GROUP_COUNT];
+        std::fill(waitingMate, waitingMate + DIET_GROUP_COUNT, -1);
+
+        for (int c : occupancy.onTile(t)) {
+            if (dead[c]) continue;  // mangée plus tôt sur la tile
+
+            switch (static_cast<Action>(actions[c])) {
+            case Action::EatPlant: {
+                float taken = std::min(plant[t], hunger[c] * PLANT_PER_HUNGER);
+                plant[t] -= taken;
+                hunger[c] -= taken / PLANT_PER_HUNGER;
+                break;
+            }
+            case Action::EatMeat: {
+                float taken = std::min(meat[t], hunger[c] * MEAT_PER_HUNGER);
+                meat[t] -= taken;
+                hunger[c] -= taken / MEAT_PER_HUNGER;
+                break;
+            }
+            case Action::Drink: {
+                // sur l'eau la réserve est infinie et le reste
+                float taken = std::min(water[t], thirst[c] * WATER_PER_THIRST);
+                water[t] -= taken;
+                thirst[c] -= taken / WATER_PER_THIRST;
+                break;
+            }
+            case Action::Move:
+                scents.deposit(t, static_cast<int>(dietGroup(diet[c])), SCENT_DEPOSIT, tickCount);
+                tile[c] = targets[c];
+                break;
+            case Action::Mate: {
+                // les candidats d'un même régime sont appariés dans l'ordre de l'index
+                int& partner = waitingMate[static_cast<int>(dietGroup(diet[c]))];
+                if (partner < 0) {
+                    partner = c;
+                    break;
+                }
+
+                // le petit naît entre les ticks (applyDeathsAndBirths)
+                mates[c] = partner;
+                love[partner] = 0.0f;
+                love[c] = 0.0f;
+                hunger[partner] += BIRTH_COST;
+                hunger[c] += BIRTH_COST;
+                partner = -1;
+                break;
+            }
+            case Action::Hunt: {
+                // proie déjà prise par un autre chasseur : le tour est perdu
+                const int prey = targets[c];
+                if (dead[prey] || static_cast<EncounterResult>(huntResults[c]) != EncounterResult::PreyEaten) break;
+
+                dead[prey] = 1;
+                // ce que le chasseur ne mange pas reste sur la tile
+                float food = size[prey] * MEAT_PER_SIZE;
+                float taken = std::min(food, hunger[c] * MEAT_PER_HUNGER);
+                hunger[c] -= taken / MEAT_PER_HUNGER;
+                meat[t] += food - taken;
+                break;
+            }
+            case Action::Rest:
+                break;
+            }
+        }
+
+        for (int c : occupancy.onTile(t)) {
+            if (!dead[c] && (hunger[c] >= 1.0f || thirst[c] >= 1.0f)) {
+                dead[c] = 1;
+                meat[t] += size[c] * MEAT_PER_SIZE;
+            }
+        }
+    }
+}
+
+void Simulation::applyDeathsAndBirths() {
+    deaths.clear();
+    newTraits.clear();
+    newTiles.clear();
+
+    // les parents sont lus avant le compactage (un parent peut être mort pendant le tick)
+    const int* tile = store.tiles();
+    for (int c = 0; c < store.count(); ++c) {
+        if (mates[c] < 0) continue;
+
+        CreatureTraits child = store.traitsAt(mates[c]);
+        CreatureTraits other = store.traitsAt(c);
+        for (int k = 0; k < TRAIT_COUNT; ++k) {
+            child.values[k] = 0.5f * (child.values[k] + other.values[k]);
+        }
+        newTraits.push_back(child);
+        newTiles.push_back(tile[c]);
+    }
+    for (int c = 0; c < store.count(); ++c) {
+        if (dead[c]) deaths.push_back(c);
+    }
+
+    // toutes les morts d'un coup (index déjà croissants), les slots libérés servent aux naissances
+    store.compact(deaths);
+
+    if (newTraits.empty()) return;
+
+    // chaque nouveau-né peut muter (tirages : chance, caractéristique, ampleur)
+    const int first = store.spawnBulk(newTraits, newTiles);
+    const int nbBirths = static_cast<int>(newTraits.size());
+    for (auto& draws : randomDraws) draws.resize(nbBirths);
+    float* const outputs[] = {randomDraws[0].data(), randomDraws[1].data(), randomDraws[2].data()};
+    rng::uniformBatch(seed, store.ids() + first, nbBirths, tickCount, rng::Purpose::Mutation, outputs, 3);
+    creatureSystems::mutate(store, first, first + nbBirths, outputs[0], outputs[1], outputs[2], params);
+}
+
+/* ----- empreinte ----- */
+
+// FNV-1a sur des mots de 32 bits
+static void hashWords(uint64_t& hash, const void* data, size_t bytes) {
+    const unsigned char* p = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i + 4 <= bytes; i += 4) {
+        uint32_t word;
+        std::memcpy(&word, p + i, 4);
+        hash = (hash ^ word) * 0x100000001B3ull;
+    }
+}
+
+uint64_t Simulation::stateHash() const {
+    uint64_t hash = 0xCBF29CE484222325ull;
+    const size_t n = static_cast<size_t>(store.count());
+
+    hashWords(hash, &tickCount, sizeof(tickCount));
+    hashWords(hash, &n, sizeof(n));
+    for (int t = 0; t < TRAIT_COUNT; ++t) hashWords(hash, store.trait(static_cast<Trait>(t)), n * sizeof(float));
+    for (int d = 0; d < DRIVE_COUNT; ++d) hashWords(hash, store.drive(static_cast<Drive>(d)), n * sizeof(float));
+    hashWords(hash, store.tiles(), n * sizeof(int));
+    hashWords(hash, store.ages(), n * sizeof(int));
+    hashWords(hash, store.ids(), n * sizeof(uint32_t));
+    for (int r = 0; r < RESOURCE_COUNT; ++r) {
+        hashWords(hash, fields.field(static_cast<Resource>(r)), fields.count() * sizeof(float));
+    }
+    return hash;
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#ifndef SIMULATION_HPP
+#define SIMULATION_HPP
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "CreatureParams.hpp"
+#include "CreatureStore.hpp"
+#include "encounters.hpp"
+#include "OccupancyIndex.hpp"
+#include "ScentGrid.hpp"
+#include "../environment/HexGrid.hpp"
+#include "../environment/ResourceFields.hpp"
+#include "../utils/AlignedArray.hpp"
+#include "../utils/ThreadPool.hpp"
+
+// ce qu'une créature a décidé de faire pendant le tick
+enum class Action : uint8_t {
+    Rest,
+    EatPlant,
+    EatMeat,
+    Drink,
+    Move,   // vers la tile target
+    Mate,   // avec une créature du même régime sur la tile
+    Hunt,   // attaque la créature target sur la tile
+};
+
+/**
+ * Simulation des créatures sur une carte générée.
+ * Un tick se déroule en phases séparées par les barrières de ThreadPool::parallelFor :
+ *   1. ressources et besoins avancent d'un tick (par blocs de tiles / de créatures)
+ *   2. index d'occupation des tiles
+ *   3. sense / decide : chaque créature lit le monde sans le modifier et écrit sa décision
+ *      puis les chasses de tout le tick sont résolues d'un bloc (encounters::resolve)
+ *   4. act : les décisions sont appliquées tile par tile, chaque bloc de tiles ne touche
+ *      qu'à ses tiles et aux créatures qui s'y trouvent (ordre fixé par l'index)
+ *   5. morts et naissances, marquées par créature pendant act puis appliquées dans l'ordre
+ *      des index (compactage du store en un passage, slots libérés repris par les naissances)
+ * Les blocs ont une taille fixe : le monde obtenu ne dépend pas du nombre de threads,
+ * stateHash permet de le vérifier.
+ * Tous les tableaux de travail ont la taille de la population et gardent leur capacité :
+ * un tick n'alloue rien tant que la population ne dépasse pas son maximum précédent.
+ */
+class Simulation {
+public:
+    explicit Simulation(int nbThreads = 0);
+
+    // nouvelle population de nbCreatures sur les tiles de terre de la carte
+    void reset(const HexGrid& grid, const std::vector<int>& distToWater, int nbCreatures, uint32_t seed);
+    void tick();
+    /**
+     * Reprise d'un état sauvegardé (loadSnapshot) : remplace carte, ressources, odeurs et
+     * créatures, les paramètres sont relus dans gameParam
+     */
+    void restore(HexGrid&& map, ResourceFields&& resources, ScentGrid&& scentGrid, CreatureStore&& creatures,
+                 uint32_t seed, uint32_t tick);
+
+    uint32_t currentTick() const { return tickCount; }
+    uint32_t randomSeed() const { return seed; }
+    // empreinte de tout l'état simulé (créatures, ressources, tick)
+    uint64_t stateHash() const;
+
+    const HexGrid& map() const { return grid; }
+    const CreatureStore& creatures() const { return store; }
+    const ResourceFields& resources() const { return fields; }
+    const ScentGrid& scentGrid() const { return scents; }
+    // threads de la simulation, libres entre deux ticks (copie des snapshots)
+    ThreadPool& threadPool() const { return *pool; }
+
+private:
+    std::unique_ptr<ThreadPool> pool;
+    HexGrid grid;
+    CreatureStore store;
+    OccupancyIndex occupancy;
+    ResourceFields fields;
+    ScentGrid scents;
+    CreatureParams params;
+    uint32_t seed = 0;
+    uint32_t tickCount = 0;
+
+    AlignedArray<uint8_t> actions;  // Action de chaque créature
+    AlignedArray<int> targets;      // tile visée par Move, proie visée par Hunt
+    AlignedArray<float> dietRolls;  // dé du choix de nourriture, tiré pour toute la population
+    EncounterBatch hunts;
+    AlignedArray<uint8_t> huntResults;  // EncounterResult de chaque chasseur
+    AlignedArray<uint8_t> dead;         // mortes pendant le tick (mangées, de faim ou de soif)
+    AlignedArray<int> mates;            // partenaire si la créature a eu un petit, -1 sinon
+    std::vector<int> deaths;
+    std::vector<CreatureTraits> newTraits;
+    std::vector<int> newTiles;
+    std::vector<float> randomDraws[3];
+
+    int findPrey(int hunter, float roll) const;
+    void decide(int begin, int end);
+    void act(int firstTile, int lastTile);
+    void applyDeathsAndBirths();
+};
+
+#endif // SIMULATION_HPP
@@ -0,0 +1,312 @@
+#include "Snapshot.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <utility>
+
+#include "../gameParam.hpp"
+#include "../environment/DistanceField.hpp"
+#include "../paramConfig.hpp"
+#include "../utils/MappedFile.hpp"
+
+namespace {
+    constexpr char MAGIC[4] = {'H', 'X', 'S', 'N'};
+    constexpr uint32_t VERSION = 3;  // 2 : plus de section eau (déduite du biome), 3 : plus de capacités
+    constexpr size_t SECTION_ALIGNMENT = 64;
+    // découpage de la copie sur le pool de la simulation (taille fixe, comme les ticks)
+    constexpr int TILES_PER_COPY_BLOCK = 4096;
+    constexpr size_t COPY_CHUNK = size_t{1} << 20;
+
+    // champs flottants des tiles, dans l'ordre de la section tiles
+    constexpr float Tile::* TILE_FLOATS[] = {&Tile::height, &Tile::temperature, &Tile::precipitation, &Tile::flow};
+    constexpr int NB_TILE_FLOATS = sizeof(TILE_FLOATS) / sizeof(TILE_FLOATS[0]);
+
+    // colonne des tiles et colonne des slots parmi CreatureStore::SavedState::columns
+    constexpr int TILE_COLUMN = TRAIT_COUNT + DRIVE_COUNT;
+    constexpr int SLOT_COLUMN = CreatureStore::SAVED_COLUMNS - 1;
+
+    struct SnapshotHeader {
+        char magic[4];
+        uint32_t version;
+        uint32_t tick;
+        uint32_t seed;
+        int32_t mapSize;
+        int32_t nbTiles;
+        int32_t nbCreatures;
+        int32_t nbSlots;
+        uint32_t freeHead;
+        uint32_t nextId;
+        uint32_t paramBytes;
+        uint32_t scentSlotSize;  // sizeof(ScentSlot) à l'écriture
+        uint64_t fileSize;
+    };
+
+    // début de chaque section, calculé de la même façon à l'écriture et à la lecture
+    struct SnapshotLayout {
+        size_t params;
+        size_t tileFloats[NB_TILE_FLOATS];
+        size_t biomes;
+        size_t resources[ResourceFields::SAVED_ARRAYS];
+        size_t scents;
+        size_t columns[CreatureStore::SAVED_COLUMNS];
+        size_t slotIndex;
+        size_t slotGeneration;
+        size_t end;
+
+        explicit SnapshotLayout(const SnapshotHeader& header) {
+            const size_t nbTiles = static_cast<size_t>(header.nbTiles);
+            const size_t nbCreatures = static_cast<size_t>(header.nbCreatures);
+            const size_t nbSlots = static_cast<size_t>(header.nbSlots);
+
+            size_t offset = sizeof(SnapshotHeader);
+            auto section = [&](size_t bytes) {
+                size_t start = (offset + SECTION_ALIGNMENT - 1) / SECTION_ALIGNMENT * SECTION_ALIGNMENT;
+                offset = start + bytes;
+                return start;
+            };
+
+            params = section(header.paramBytes);
+            for (size_t& start : tileFloats) start = section(nbTiles * sizeof(float));
+            biomes = section(nbTiles * sizeof(int32_t));
+            for (size_t& start : resources) start = section(nbTiles * sizeof(float));
+            scents = section(nbTiles * ScentGrid::SLOTS * sizeof(ScentSlot));
+            for (size_t& start : columns) start = section(nbCreatures * 4);
+            slotIndex = section(nbSlots * sizeof(uint32_t));
+            slotGeneration = section(nbSlots * sizeof(uint32_t));
+            end = offset;
+        }
+    };
+
+    /**
+     * Écrit dans un fichier temporaire puis renommé : un snapshot n'est jamais à moitié écrit.
+     * Passe par stdio (pas d'operator new) : le thread d'écriture n'apparaît pas dans le
+     * compteur d'allocations des ticks qui tournent en même temps.
+     */
+    bool writeImage(const std::string& tmpPath, const std::string& path, const std::vector<unsigned char>& image) {
+        std::FILE* file = std::fopen(tmpPath.c_str(), "wb");
+        if (!file) return false;
+
+        bool ok = std::fwrite(image.data(), 1, image.size(), file) == image.size();
+        ok = (std::fclose(file) == 0) && ok;
+        if (!ok) return false;
+#ifdef _WIN32
+        // rename ne remplace pas un fichier existant sous Windows
+        std::remove(path.c_str());
+#endif
+        return std::rename(tmpPath.c_str(), path.c_str()) == 0;
+    }
+
+    template <typename T>
+    T readValue(const unsigned char* data, size_t offset, size_t index) {
+        T value;
+        std::memcpy(&value, data + offset + index * sizeof(T), sizeof(T));
+        return value;
+    }
+
+    template <typename T>
+    void writeValue(unsigned char* data, size_t offset, size_t index, T value) {
+        std::memcpy(data + offset + index * sizeof(T), &value, sizeof(T));
+    }
+
+    /**
+     * Table des slots cohérente avant CreatureStore::restore (takeSlot et find s'y fient) :
+     * chaque créature a son propre slot qui pointe sur elle, et la liste des slots libres
+     * part de freeHead, reste dans [0, nbSlots), passe une seule fois par chacun des autres
+     * slots et finit sur NONE.
+     */
+    bool validSlots(const SnapshotHeader& header, const SnapshotLayout& layout, const unsigned char* data) {
+        const uint32_t nbSlots = static_cast<uint32_t>(header.nbSlots);
+        std::vector<uint8_t> used(nbSlots, 0);
+
+        for (int i = 0; i < header.nbCreatures; ++i) {
+            uint32_t slot = readValue<uint32_t>(data, layout.columns[SLOT_COLUMN], i);
+            if (slot >= nbSlots || used[slot]) return false;
+            if (readValue<uint32_t>(data, layout.slotIndex, slot) != static_cast<uint32_t>(i)) return false;
+            used[slot] = 1;
+        }
+
+        uint32_t nbFree = 0;
+        for (uint32_t slot = header.freeHead; slot != CreatureHandle::NONE; slot = readValue<uint32_t>(data, layout.slotIndex, slot)) {
+            if (slot >= nbSlots || used[slot]) return false;
+            used[slot] = 1;
+            nbFree++;
+        }
+        return nbFree == nbSlots - static_cast<uint32_t>(header.nbCreatures);
+    }
+}
+
+/* ----- écriture ----- */
+
+SnapshotWriter::~SnapshotWriter() {
+    wait();
+}
+
+bool SnapshotWriter::wait() {
+    if (worker.joinable()) worker.join();
+    return lastWriteOk;
+}
+
+bool SnapshotWriter::save(const Simulation& simulation, const std::string& path) {
+    if (writing.load()) return false;
+    if (worker.joinable()) worker.join();
+
+    const HexGrid& grid = simulation.map();
+    const CreatureStore::SavedState creatures = simulation.creatures().savedState();
+    const std::string params = gameParamText();
+
+    SnapshotHeader header{};
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.tick = simulation.currentTick();
+    header.seed = simulation.randomSeed();
+    header.mapSize = grid.size();
+    header.nbTiles = grid.count();
+    header.nbCreatures = creatures.count;
+    header.nbSlots = creatures.nbSlots;
+    header.freeHead = creatures.freeHead;
+    header.nextId = creatures.nextId;
+    header.paramBytes = static_cast<uint32_t>(params.size());
+    header.scentSlotSize = sizeof(ScentSlot);
+
+    const SnapshotLayout layout(header);
+    header.fileSize = layout.end;
+
+    // image complète du fichier : le thread d'écriture n'a plus qu'un bloc à envoyer
+    image.resize(layout.end);
+    unsigned char* out = image.data();
+    std::memcpy(out, &header, sizeof(header));
+    std::memcpy(out + layout.params, params.data(), params.size());
+
+    // la copie retient le tick suivant : elle est répartie sur les threads de la simulation
+    ThreadPool& pool = simulation.threadPool();
+    pool.parallelFor(grid.count(), TILES_PER_COPY_BLOCK, [&](int first, int last) {
+        for (int i = first; i < last; ++i) {
+            const Tile& tile = grid[i];
+            for (int f = 0; f < NB_TILE_FLOATS; ++f) writeValue(out, layout.tileFloats[f], i, tile.*TILE_FLOATS[f]);
+            writeValue(out, layout.biomes, i, static_cast<int32_t>(tile.biome.biomeType));
+        }
+    });
+
+    // tous les tableaux denses, en morceaux de COPY_CHUNK octets
+    copies.clear();
+    auto addCopy = [&](size_t offset, const void* source, size_t bytes) {
+        const unsigned char* from = static_cast<const unsigned char*>(source);
+        for (size_t done = 0; done < bytes; done += COPY_CHUNK) {
+            copies.push_back(CopyChunk{out + offset + done, from + done, std::min(COPY_CHUNK, bytes - done)});
+        }
+    };
+
+    const size_t nbTiles = static_cast<size_t>(grid.count());
+    const auto resources = simulation.resources().savedArrays();
+    for (int r = 0; r < ResourceFields::SAVED_ARRAYS; ++r) {
+        addCopy(layout.resources[r], resources[r], nbTiles * sizeof(float));
+    }
+    addCopy(layout.scents, simulation.scentGrid().savedSlots(), nbTiles * ScentGrid::SLOTS * sizeof(ScentSlot));
+
+    const size_t nbCreatures = static_cast<size_t>(creatures.count);
+    const size_t nbSlots = static_cast<size_t>(creatures.nbSlots);
+    for (int c = 0; c < CreatureStore::SAVED_COLUMNS; ++c) {
+        addCopy(layout.columns[c], creatures.columns[c], nbCreatures * 4);
+    }
+    addCopy(layout.slotIndex, creatures.slotIndex, nbSlots * sizeof(uint32_t));
+    addCopy(layout.slotGeneration, creatures.slotGeneration, nbSlots * sizeof(uint32_t));
+
+    pool.parallelFor(static_cast<int>(copies.size()), 1, [&](int first, int last) {
+        for (int k = first; k < last; ++k) std::memcpy(copies[k].target, copies[k].source, copies[k].bytes);
+    });
+
+    targetPath = path;
+    tmpPath = path + ".tmp";
+    writing.store(true);
+    worker = std::thread([this] {
+        lastWriteOk = writeImage(tmpPath, targetPath, image);
+        writing.store(false);
+    });
+    return true;
+}
+
+/* ----- lecture ----- */
+
+bool loadSnapshot(const std::string& path, Simulation& simulation, const std::string& overrides) {
+    MappedFile file;
+    if (!file.open(path) || file.size() < sizeof(SnapshotHeader)) return false;
+
+    SnapshotHeader header;
+    std::memcpy(&header, file.data(), sizeof(header));
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.version != VERSION
+        || header.scentSlotSize != sizeof(ScentSlot) || header.fileSize != file.size()
+        || header.mapSize < 0 || header.nbTiles < 0 || header.nbCreatures < 0 || header.nbSlots < header.nbCreatures) {
+        return false;
+    }
+
+    const SnapshotLayout layout(header);
+    if (layout.end != file.size()) return false;
+    const unsigned char* data = file.data();
+
+    // tout est vérifié avant de toucher à gameParam et à la simulation ;
+    // nbTiles est borné par la taille du fichier, mapSize doit lui correspondre avant d'allouer la grille
+    if (HexGrid::tileCount(header.mapSize) != header.nbTiles) return false;
+    HexGrid grid;
+    grid.resize(header.mapSize);
+
+    for (int i = 0; i < header.nbTiles; ++i) {
+        int32_t biome = readValue<int32_t>(data, layout.biomes, i);
+        if (biome < 0 || biome > static_cast<int32_t>(BiomeType::None)) return false;
+    }
+    for (int i = 0; i < header.nbCreatures; ++i) {
+        int32_t tile = readValue<int32_t>(data, layout.columns[TILE_COLUMN], i);
+        if (tile < 0 || tile >= header.nbTiles) return false;
+    }
+    if (!validSlots(header, layout, data)) return false;
+
+    // paramètres du snapshot puis ceux de l'appelant, avant de reconstruire ressources et odeurs ;
+    // les deux textes sont vérifiés avant d'en appliquer un seul
+    const std::string params(reinterpret_cast<const char*>(data + layout.params), header.paramBytes);
+    if (!checkGameParamText(params, path) || !checkGameParamText(overrides, "ligne de commande")) return false;
+    loadGameParamText(params, path);
+    loadGameParamText(overrides, "ligne de commande");
+
+    // une copie de chaque biome, les tiles la reprennent (nom et couleur compris)
+    Biome biomes[static_cast<int>(BiomeType::None) + 1];
+    for (int type = 0; type <= static_cast<int>(BiomeType::None); ++type) {
+        biomes[type] = getBiome(static_cast<BiomeType>(type));
+    }
+    for (int i = 0; i < header.nbTiles; ++i) {
+        Tile& tile = grid[i];
+        for (int f = 0; f < NB_TILE_FLOATS; ++f) tile.*TILE_FLOATS[f] = readValue<float>(data, layout.tileFloats[f], i);
+        const int32_t biome = readValue<int32_t>(data, layout.biomes, i);
+        tile.biome = biomes[biome];
+        tile.isWater = biome == static_cast<int32_t>(BiomeType::Water);
+    }
+
+    ResourceFields fields;
+    std::array<const float*, ResourceFields::SAVED_ARRAYS> resources;
+    for (int r = 0; r < ResourceFields::SAVED_ARRAYS; ++r) {
+        resources[r] = reinterpret_cast<const float*>(data + layout.resources[r]);
+    }
+    // capacités recalculées avec les paramètres remplacés (meat_decay, water_scale...)
+    std::vector<int> distToWater;
+    distanceField::computeDistToWater(grid, distToWater);
+    fields.restore(grid, distToWater, resources, ResourceParams::current());
+
+    ScentGrid scents;
+    scents.resize(header.nbTiles, gameParam::scent_lifetime);
+    scents.restore(header.nbTiles, reinterpret_cast<const ScentSlot*>(data + layout.scents));
+
+    CreatureStore::SavedState creatures;
+    creatures.count = header.nbCreatures;
+    creatures.nbSlots = header.nbSlots;
+    creatures.freeHead = header.freeHead;
+    creatures.nextId = header.nextId;
+    for (int c = 0; c < CreatureStore::SAVED_COLUMNS; ++c) creatures.columns[c] = data + layout.columns[c];
+    creatures.slotIndex = reinterpret_cast<const uint32_t*>(data + layout.slotIndex);
+    creatures.slotGeneration = reinterpret_cast<const uint32_t*>(data + layout.slotGeneration);
+
+    CreatureStore store;
+    store.restore(creatures);
+
+    simulation.restore(std::move(grid), std::move(fields), std::move(scents), std::move(store), header.seed, header.tick);
+    return true;
+}
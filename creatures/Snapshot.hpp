@@ -0,0 +1,73 @@
+#pragma once
+
+#ifndef SNAPSHOT_HPP
+#define SNAPSHOT_HPP
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Simulation.hpp"
+
+/**
+ * Snapshot binaire d'une simulation, pour la reprendre plus tard là où elle en était
+ * (le tick suivant donne la même empreinte stateHash que sans interruption).
+ *
+ * Format (little endian, chaque section commence sur un multiple de 64 octets) :
+ *   en-tête SnapshotHeader
+ *   paramètres : texte "cle = valeur" de gameParam (gameParamText)
+ *   tiles : hauteur, température, précipitations, flux (float), biome (int32)
+ *   ressources : ResourceFields::SAVED_ARRAYS tableaux de float
+ *   odeurs : ScentGrid::SLOTS ScentSlot par tile
+ *   créatures : CreatureStore::SAVED_COLUMNS colonnes de 4 octets, table des slots
+ * Le fichier est lu par projection en mémoire, les colonnes sont copiées d'un bloc.
+ */
+class SnapshotWriter {
+public:
+    SnapshotWriter() = default;
+    ~SnapshotWriter();
+
+    SnapshotWriter(const SnapshotWriter&) = delete;
+    SnapshotWriter& operator=(const SnapshotWriter&) = delete;
+
+    /**
+     * Copie l'état dans le tampon du writer entre deux ticks, puis l'écrit dans un thread à
+     * part : la simulation continue pendant l'écriture. La copie, elle, retient le tick
+     * suivant ; elle est répartie sur le ThreadPool de la simulation (bornée par la bande
+     * passante mémoire, pas par un seul coeur).
+     * false (rien n'est fait) si le snapshot précédent est encore en cours d'écriture.
+     */
+    bool save(const Simulation& simulation, const std::string& path);
+
+    bool busy() const { return writing.load(); }
+    // attend la fin de l'écriture en cours, false si elle a échoué
+    bool wait();
+
+private:
+    // morceau de tableau copié dans image par une tâche du pool
+    struct CopyChunk {
+        unsigned char* target;
+        const unsigned char* source;
+        size_t bytes;
+    };
+
+    std::vector<unsigned char> image;  // fichier complet, gardé d'un snapshot à l'autre
+    std::vector<CopyChunk> copies;     // gardé aussi : pas d'allocation une fois la taille atteinte
+    std::string targetPath;
+    std::string tmpPath;
+    std::thread worker;
+    std::atomic<bool> writing{false};
+    bool lastWriteOk = true;
+};
+
+/**
+ * Remplace gameParam et l'état de la simulation, false si le fichier est absent ou invalide.
+ * overrides : lignes "cle = valeur" appliquées après les paramètres du snapshot. Capacités et
+ * vitesses des ressources, durée des odeurs et paramètres des créatures sont recalculés
+ * ensuite et en tiennent compte ; les paramètres de la carte (map_size, map_seed, seuils
+ * d'eau...) n'ont pas d'effet, la carte est celle du snapshot.
+ */
+bool loadSnapshot(const std::string& path, Simulation& simulation, const std::string& overrides = "");
+
+#endif // SNAPSHOT_HPP
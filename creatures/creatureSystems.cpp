@@ -0,0 +1,125 @@
+#include "creatureSystems.hpp"
+
+#include <algorithm>
+
+#include "../utils/Simd.hpp"
+
+#if SIMD_HAS_AVX2
+#include <immintrin.h>
+#endif
+
+static constexpr float DIET_BOUND = 99.0f;
+static constexpr float MIN_TRAIT = 0.01f; // une caractéristique ne tombe jamais à 0
+
+// colonnes lues et écrites par updateDrives
+struct DriveColumns {
+    const float* __restrict size;
+    const float* __restrict speed;
+    const float* __restrict reproduction;
+    const float* __restrict diet;
+    const float* __restrict perception;
+    float* __restrict hunger;
+    float* __restrict thirst;
+    float* __restrict love;
+    int* __restrict age;
+
+    explicit DriveColumns(CreatureStore& store)
+        : size(store.trait(Trait::Size)),
+          speed(store.trait(Trait::Speed)),
+          reproduction(store.trait(Trait::Reproduction)),
+          diet(store.trait(Trait::Diet)),
+          perception(store.trait(Trait::Perception)),
+          hunger(store.drive(Drive::Hunger)),
+          thirst(store.drive(Drive::Thirst)),
+          love(store.drive(Drive::Love)),
+          age(store.ages()) {}
+};
+
+static void updateDrivesScalar(const DriveColumns& c, int begin, int end, const CreatureParams& p) {
+    for (int i = begin; i < end; ++i) {
+        float metabolism = c.size[i] * (0.5f + 0.5f * c.speed[i]) * (1.0f + p.perception_cost * c.perception[i]);
+        // 1 pour un herbivore pur (-99), 0.5 pour un carnivore pur (99)
+        float dietFactor = 1.0f - 0.25f * (c.diet[i] + DIET_BOUND) / DIET_BOUND;
+
+        c.hunger[i] = std::min(c.hunger[i] + p.hunger_rate * metabolism * dietFactor, 1.0f);
+        c.thirst[i] = std::min(c.thirst[i] + p.thirst_rate * metabolism, 1.0f);
+
+        c.age[i] += 1;
+        float gain = (c.age[i] >= p.maturity_age) ? p.love_rate * c.reproduction[i] : 0.0f;
+        c.love[i] = std::min(c.love[i] + gain, 1.0f);
+    }
+}
+
+#if SIMD_HAS_AVX2
+// mêmes opérations dans le même ordre que updateDrivesScalar (pas de FMA) : résultats identiques
+SIMD_TARGET_AVX2
+static int updateDrivesAvx2(const DriveColumns& c, int begin, int end, const CreatureParams& p) {
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 half = _mm256_set1_ps(0.5f);
+    const __m256 quarter = _mm256_set1_ps(0.25f);
+    const __m256 dietBound = _mm256_set1_ps(DIET_BOUND);
+    const __m256 perceptionCost = _mm256_set1_ps(p.perception_cost);
+    const __m256 hungerRate = _mm256_set1_ps(p.hunger_rate);
+    const __m256 thirstRate = _mm256_set1_ps(p.thirst_rate);
+    const __m256 loveRate = _mm256_set1_ps(p.love_rate);
+    const __m256i oneTick = _mm256_set1_epi32(1);
+    const __m256i immature = _mm256_set1_epi32(p.maturity_age - 1);
+
+    int i = begin;
+    for (; i + 8 <= end; i += 8) {
+        __m256 metabolism = _mm256_mul_ps(
+            _mm256_mul_ps(_mm256_loadu_ps(c.size + i), _mm256_add_ps(half, _mm256_mul_ps(half, _mm256_loadu_ps(c.speed + i)))),
+            _mm256_add_ps(one, _mm256_mul_ps(perceptionCost, _mm256_loadu_ps(c.perception + i))));
+        __m256 dietFactor = _mm256_sub_ps(one, _mm256_div_ps(
+            _mm256_mul_ps(quarter, _mm256_add_ps(_mm256_loadu_ps(c.diet + i), dietBound)), dietBound));
+
+        __m256 hunger = _mm256_add_ps(_mm256_loadu_ps(c.hunger + i),
+                                      _mm256_mul_ps(_mm256_mul_ps(hungerRate, metabolism), dietFactor));
+        _mm256_storeu_ps(c.hunger + i, _mm256_min_ps(hunger, one));
+        __m256 thirst = _mm256_add_ps(_mm256_loadu_ps(c.thirst + i), _mm256_mul_ps(thirstRate, metabolism));
+        _mm256_storeu_ps(c.thirst + i, _mm256_min_ps(thirst, one));
+
+        __m256i age = _mm256_add_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(c.age + i)), oneTick);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(c.age + i), age);
+        __m256 mature = _mm256_castsi256_ps(_mm256_cmpgt_epi32(age, immature));
+        __m256 gain = _mm256_and_ps(mature, _mm256_mul_ps(loveRate, _mm256_loadu_ps(c.reproduction + i)));
+        _mm256_storeu_ps(c.love + i, _mm256_min_ps(_mm256_add_ps(_mm256_loadu_ps(c.love + i), gain), one));
+    }
+    return i;
+}
+#endif
+
+void creatureSystems::updateDrives(CreatureStore& store, int begin, int end, const CreatureParams& p) {
+    const DriveColumns columns(store);
+
+    int done = begin;
+#if SIMD_HAS_AVX2
+    if (simd::hasAvx2()) {
+        done = updateDrivesAvx2(columns, begin, end, p);
+    }
+#endif
+    // reste (ou tout si pas d'AVX2)
+    updateDrivesScalar(columns, done, end, p);
+}
+
+void creatureSystems::mutate(CreatureStore& store, int begin, int end,
+                             const float* roll, const float* choice, const float* amount, const CreatureParams& p) {
+    const int count = end - begin;
+
+    // une colonne à la fois : chaque créature n'est modifiée que dans la colonne tirée
+    for (int t = 0; t < TRAIT_COUNT; ++t) {
+        float* column = store.trait(static_cast<Trait>(t)) + begin;
+        const bool isDiet = (t == static_cast<int>(Trait::Diet));
+
+        for (int i = 0; i < count; ++i) {
+            if (roll[i] >= p.mutation_chance || static_cast<int>(choice[i] * TRAIT_COUNT) != t) continue;
+
+            float delta = (2.0f * amount[i] - 1.0f) * p.mutation_amount;
+            if (isDiet) {
+                column[i] = std::clamp(column[i] + delta * DIET_BOUND, -DIET_BOUND, DIET_BOUND);
+            } else {
+                column[i] = std::max(MIN_TRAIT, column[i] * (1.0f + delta));
+            }
+        }
+    }
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "CreatureParams.hpp"
+#include "CreatureStore.hpp"
+
+/**
+ * Passes sur une plage [begin, end) d'index denses de la population.
+ * Chaque passe lit et écrit les colonnes de CreatureStore en continu ; updateDrives, appelée
+ * sur toute la population à chaque tick, traite 8 créatures par instruction en AVX2.
+ * Deux plages disjointes peuvent être traitées en même temps par des threads différents.
+ */
+namespace creatureSystems {
+    /**
+     * Un tick de métabolisme : l'âge avance, la faim et la soif montent selon la taille,
+     * la vitesse et la perception (les carnivores ont faim deux fois moins vite que les
+     * herbivores), l'amour monte selon le taux de reproduction une fois la maturité atteinte.
+     * Les besoins restent dans [0, 1].
+     */
+    void updateDrives(CreatureStore& store, int begin, int end, const CreatureParams& p);
+
+    /**
+     * Mutation des créatures [begin, end) (les nouveau-nés d'un spawnBulk) :
+     * roll, choice et amount contiennent end - begin tirages uniformes dans [0, 1).
+     * Avec roll < mutation_chance, la caractéristique choice * TRAIT_COUNT varie de
+     * +/- mutation_amount (relatif, ou en points de l'échelle -99..99 pour le régime).
+     */
+    void mutate(CreatureStore& store, int begin, int end,
+                const float* roll, const float* choice, const float* amount, const CreatureParams& p);
+}
@@ -0,0 +1,154 @@
+#include "encounters.hpp"
+
+#include <algorithm>
+
+#include "../utils/Philox.hpp"
+#include "../utils/Simd.hpp"
+
+#if SIMD_HAS_AVX2
+#include <immintrin.h>
+#endif
+
+// couples traités par morceau : tirages et id restent dans le cache
+static constexpr int CHUNK = 256;
+static constexpr float DIET_OFFSET = 99.0f;
+
+// colonnes lues par la résolution
+struct EncounterColumns {
+    const float* size;
+    const float* speed;
+    const float* diet;
+    const float* stealth;
+    const float* perception;
+
+    explicit EncounterColumns(const CreatureStore& store)
+        : size(store.trait(Trait::Size)),
+          speed(store.trait(Trait::Speed)),
+          diet(store.trait(Trait::Diet)),
+          stealth(store.trait(Trait::Stealth)),
+          perception(store.trait(Trait::Perception)) {}
+};
+
+// tirages d'un morceau : repérage par le prédateur, par la proie, esquive, combat
+struct EncounterDraws {
+    float notice[CHUNK];
+    float counterNotice[CHUNK];
+    float evade[CHUNK];
+    float fight[CHUNK];
+};
+
+static void resolveScalar(const EncounterColumns& c, const int* predators, const int* prey, const EncounterDraws& draws,
+                          int begin, int count, uint8_t* results) {
+    for (int k = begin; k < count; ++k) {
+        const int p = predators[k];
+        const int q = prey[k];
+
+        // une petite créature repère plus facilement une grande
+        float sizeSum = c.size[p] + c.size[q];
+        float predatorSees = std::min(1.0f, c.perception[p] / (c.perception[p] + c.stealth[q]) * (2.0f * c.size[q] / sizeSum));
+        float preySees = std::min(1.0f, c.perception[q] / (c.perception[q] + c.stealth[p]) * (2.0f * c.size[p] / sizeSum));
+        float escape = c.speed[q] / (c.speed[q] + c.speed[p]);
+
+        bool seen = draws.notice[k] < predatorSees;
+        bool ambush = !(draws.counterNotice[k] < preySees);
+        bool escaped = draws.evade[k] < escape;
+
+        float attack = c.size[p] * ((c.diet[p] + DIET_OFFSET) / 100.0f) * (ambush ? 2.0f : 1.0f);
+        float defense = c.size[q] * ((c.diet[q] + DIET_OFFSET) / 100.0f);
+        bool won = draws.fight[k] * (attack + defense) <= attack;
+
+        EncounterResult result = won ? EncounterResult::PreyEaten : EncounterResult::PredatorLost;
+        result = escaped ? EncounterResult::Escaped : result;
+        result = seen ? result : EncounterResult::NoAction;
+        results[k] = static_cast<uint8_t>(result);
+    }
+}
+
+#if SIMD_HAS_AVX2
+// mêmes opérations dans le même ordre que resolveScalar : résultats identiques
+SIMD_TARGET_AVX2
+static int resolveAvx2(const EncounterColumns& c, const int* predators, const int* prey, const EncounterDraws& draws,
+                       int count, uint8_t* results) {
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 two = _mm256_set1_ps(2.0f);
+    const __m256 hundred = _mm256_set1_ps(100.0f);
+    const __m256 dietOffset = _mm256_set1_ps(DIET_OFFSET);
+    const __m256i noAction = _mm256_set1_epi32(static_cast<int>(EncounterResult::NoAction));
+    const __m256i escapedResult = _mm256_set1_epi32(static_cast<int>(EncounterResult::Escaped));
+    const __m256i lost = _mm256_set1_epi32(static_cast<int>(EncounterResult::PredatorLost));
+    const __m256i eaten = _mm256_set1_epi32(static_cast<int>(EncounterResult::PreyEaten));
+
+    int k = 0;
+    for (; k + 8 <= count; k += 8) {
+        __m256i p = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(predators + k));
+        __m256i q = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(prey + k));
+
+        __m256 sizeP = _mm256_i32gather_ps(c.size, p, 4);
+        __m256 sizeQ = _mm256_i32gather_ps(c.size, q, 4);
+        __m256 perceptionP = _mm256_i32gather_ps(c.perception, p, 4);
+        __m256 perceptionQ = _mm256_i32gather_ps(c.perception, q, 4);
+        __m256 stealthP = _mm256_i32gather_ps(c.stealth, p, 4);
+        __m256 stealthQ = _mm256_i32gather_ps(c.stealth, q, 4);
+        __m256 speedP = _mm256_i32gather_ps(c.speed, p, 4);
+        __m256 speedQ = _mm256_i32gather_ps(c.speed, q, 4);
+        __m256 dietP = _mm256_i32gather_ps(c.diet, p, 4);
+        __m256 dietQ = _mm256_i32gather_ps(c.diet, q, 4);
+
+        __m256 sizeSum = _mm256_add_ps(sizeP, sizeQ);
+        __m256 predatorSees = _mm256_min_ps(_mm256_mul_ps(
+            _mm256_div_ps(perceptionP, _mm256_add_ps(perceptionP, stealthQ)),
+            _mm256_div_ps(_mm256_mul_ps(two, sizeQ), sizeSum)), one);
+        __m256 preySees = _mm256_min_ps(_mm256_mul_ps(
+            _mm256_div_ps(perceptionQ, _mm256_add_ps(perceptionQ, stealthP)),
+            _mm256_div_ps(_mm256_mul_ps(two, sizeP), sizeSum)), one);
+        __m256 escape = _mm256_div_ps(speedQ, _mm256_add_ps(speedQ, speedP));
+
+        __m256 seen = _mm256_cmp_ps(_mm256_loadu_ps(draws.notice + k), predatorSees, _CMP_LT_OQ);
+        __m256 spotted = _mm256_cmp_ps(_mm256_loadu_ps(draws.counterNotice + k), preySees, _CMP_LT_OQ);
+        __m256 escaped = _mm256_cmp_ps(_mm256_loadu_ps(draws.evade + k), escape, _CMP_LT_OQ);
+
+        __m256 attack = _mm256_mul_ps(_mm256_mul_ps(sizeP, _mm256_div_ps(_mm256_add_ps(dietP, dietOffset), hundred)),
+                                      _mm256_blendv_ps(two, one, spotted));
+        __m256 defense = _mm256_mul_ps(sizeQ, _mm256_div_ps(_mm256_add_ps(dietQ, dietOffset), hundred));
+        __m256 won = _mm256_cmp_ps(_mm256_mul_ps(_mm256_loadu_ps(draws.fight + k), _mm256_add_ps(attack, defense)),
+                                   attack, _CMP_LE_OQ);
+
+        __m256i result = _mm256_blendv_epi8(lost, eaten, _mm256_castps_si256(won));
+        result = _mm256_blendv_epi8(result, escapedResult, _mm256_castps_si256(escaped));
+        result = _mm256_blendv_epi8(noAction, result, _mm256_castps_si256(seen));
+
+        alignas(32) int lanes[8];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), result);
+        for (int l = 0; l < 8; ++l) results[k + l] = static_cast<uint8_t>(lanes[l]);
+    }
+    return k;
+}
+#endif
+
+void encounters::resolve(const CreatureStore& store, EncounterBatch& batch, int begin, int end, uint32_t seed, uint32_t tick) {
+    const EncounterColumns columns(store);
+    const uint32_t* ids = store.ids();
+
+    EncounterDraws draws;
+    uint32_t predatorIds[CHUNK];
+    float* const outputs[] = {draws.notice, draws.counterNotice, draws.evade, draws.fight};
+
+    for (int first = begin; first < end; first += CHUNK) {
+        const int count = std::min(CHUNK, end - first);
+        const int* predators = batch.predators.data() + first;
+        const int* prey = batch.prey.data() + first;
+        uint8_t* results = batch.results.data() + first;
+
+        for (int k = 0; k < count; ++k) predatorIds[k] = ids[predators[k]];
+        rng::uniformBatch(seed, predatorIds, count, tick, rng::Purpose::Encounter, outputs, 4);
+
+        int done = 0;
+#if SIMD_HAS_AVX2
+        if (simd::hasAvx2()) {
+            done = resolveAvx2(columns, predators, prey, draws, count, results);
+        }
+#endif
+        // reste (ou tout si pas d'AVX2)
+        resolveScalar(columns, predators, prey, draws, done, count, results);
+    }
+}
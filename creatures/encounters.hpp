@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "CreatureStore.hpp"
+
+// issue d'une rencontre prédateur / proie (schéma de __consigne__.txt)
+enum class EncounterResult : uint8_t {
+    NoAction,      // le prédateur n'a pas repéré la proie
+    Escaped,       // la proie a esquivé l'attaque
+    PredatorLost,  // la proie a gagné le combat
+    PreyEaten,
+};
+
+// rencontres d'un tick : une ligne par couple (index denses), résultat rempli par resolve
+struct EncounterBatch {
+    std::vector<int> predators;
+    std::vector<int> prey;
+    std::vector<uint8_t> results;
+
+    int size() const { return static_cast<int>(predators.size()); }
+    void reserve(int nbPairs) {
+        predators.reserve(nbPairs);
+        prey.reserve(nbPairs);
+        results.reserve(nbPairs);
+    }
+    void clear() {
+        predators.clear();
+        prey.clear();
+        results.clear();
+    }
+    void add(int predator, int target) {
+        predators.push_back(predator);
+        prey.push_back(target);
+        results.push_back(static_cast<uint8_t>(EncounterResult::NoAction));
+    }
+};
+
+namespace encounters {
+    // taille maximale d'une proie, en multiple de la taille du prédateur :
+    // 2 pour un carnivore pur (99), 1.5 pour un omnivore équilibré (0)
+    inline float captureLimit(float diet) {
+        return 1.0f + (diet + 99.0f) / 198.0f;
+    }
+
+    /**
+     * Résout les rencontres [begin, end) de batch d'un coup, toutes les étapes sont calculées
+     * pour chaque couple puis combinées par masques (pas de branche par couple) :
+     *   1. le prédateur repère la proie : perception contre discrétion, plus facile si la
+     *      proie est grande -> sinon NoAction
+     *   2. la proie repère le prédateur, sinon embuscade (attaque doublée)
+     *   3. esquive selon les vitesses -> Escaped
+     *   4. combat selon la taille et le régime -> PreyEaten ou PredatorLost
+     * Les 4 tirages d'un couple viennent d'un seul appel Philox (id du prédateur, tick).
+     * 8 couples par instruction en AVX2, version scalaire aux résultats identiques.
+     */
+    void resolve(const CreatureStore& store, EncounterBatch& batch, int begin, int end, uint32_t seed, uint32_t tick);
+}
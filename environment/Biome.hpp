@@ -14,10 +14,11 @@ enum class BiomeType : int {
     Desert,
     Tundra,
     Polar,
+    None,
 };
 
 struct Biome {
-    BiomeType biomeType;
+    BiomeType biomeType = BiomeType::None;
     std::string name;
     glm::vec3 color;
 };
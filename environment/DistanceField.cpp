@@ -0,0 +1,29 @@
+#include "DistanceField.hpp"
+
+void distanceField::computeDistToWater(const HexGrid& grid, std::vector<int>& dist) {
+    const int nbTiles = grid.count();
+    dist.assign(nbTiles, NO_WATER);
+
+    // file de la BFS : chaque tile y entre au plus une fois
+    std::vector<int> queue;
+    queue.reserve(nbTiles);
+
+    for (int i = 0; i < nbTiles; ++i) {
+        if (grid[i].biome.biomeType == BiomeType::Water) {
+            dist[i] = 0;
+            queue.push_back(i);
+        }
+    }
+
+    for (size_t head = 0; head < queue.size(); ++head) {
+        int current = queue[head];
+        int next = dist[current] + 1;
+
+        for (int n : grid.neighborIndices(current)) {
+            if (n != HexGrid::NO_NEIGHBOR && dist[n] == NO_WATER) {
+                dist[n] = next;
+                queue.push_back(n);
+            }
+        }
+    }
+}
\ No newline at end of file
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <limits>
+#include <vector>
+
+#include "HexGrid.hpp"
+
+/**
+ * Distance hexagonale (en nombre de tiles) de chaque tile à l'eau la plus proche.
+ * BFS multi-sources : toutes les tiles d'eau partent à 0, chaque tile est visitée
+ * une seule fois -> O(nombre de tiles).
+ * Les tiles sans eau atteignable valent NO_WATER.
+ */
+namespace distanceField {
+    inline constexpr int NO_WATER = std::numeric_limits<int>::max();
+
+    void computeDistToWater(const HexGrid& grid, std::vector<int>& dist);
+}
\ No newline at end of file
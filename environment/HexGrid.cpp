@@ -0,0 +1,106 @@
+#include "HexGrid.hpp"
+
+#include <cmath>
+
+// décalage (ligne, colonne) de chaque voisin, dans l'ordre de hexNeighbors
+// les lignes impaires sont décalées d'une demi-case vers l'Est
+static const int evenRowOffsets[6][2] = {
+    { 0,  1}, // Est
+    {-1,  0}, // Nord_Est
+    {-1, -1}, // Nord_Ouest
+    { 0, -1}, // Ouest
+    { 1, -1}, // Sud_Ouest
+    { 1,  0}, // Sud_Est
+};
+static const int oddRowOffsets[6][2] = {
+    { 0,  1}, // Est
+    {-1,  1}, // Nord_Est
+    {-1,  0}, // Nord_Ouest
+    { 0, -1}, // Ouest
+    { 1,  0}, // Sud_Ouest
+    { 1,  1}, // Sud_Est
+};
+
+void HexGrid::resize(int mapSize) {
+    this->mapSize = mapSize;
+
+    int nbTiles = static_cast<int>(tileCount(mapSize));
+    tiles.assign(nbTiles, Tile());
+    xs.resize(nbTiles);
+    ys.resize(nbTiles);
+
+    for (int row = 0; row < mapSize; ++row) {
+        for (int col = 0; col < colsInRow(row); ++col) {
+            Tile& tile = tiles[index(row, col)];
+            tile.hexCoord = HexCoord{col + ((row % 2) ? 0.5f : 0.0f), static_cast<float>(row)};
+            tile.index = index(row, col);
+            xs[tile.index] = tile.hexCoord.x;
+            ys[tile.index] = tile.hexCoord.y;
+        }
+    }
+
+    buildNeighbors();
+}
+
+void HexGrid::clear() {
+    mapSize = 0;
+    tiles.clear();
+    neighbors.clear();
+    xs.clear();
+    ys.clear();
+}
+
+bool HexGrid::contains(int row, int col) const {
+    return row >= 0 && row < mapSize && col >= 0 && col < colsInRow(row);
+}
+
+int HexGrid::rowStart(int row) const {
+    // une paire de lignes (paire + impaire) contient 2 * mapSize - 1 tiles
+    return (row / 2) * (2 * mapSize - 1) + (row % 2) * mapSize;
+}
+
+int HexGrid::index(int row, int col) const {
+    return rowStart(row) + col;
+}
+
+int HexGrid::index(const HexCoord& hc) const {
+    // x = col (+ 0.5 sur les lignes impaires) donc la partie entière donne la colonne
+    return index(static_cast<int>(hc.y), static_cast<int>(std::floor(hc.x)));
+}
+
+Tile* HexGrid::at(int row, int col) {
+    if (!contains(row, col)) return nullptr;
+    return &tiles[index(row, col)];
+}
+
+Tile* HexGrid::getNeighbor(const Tile& tile, hexNeighbors direction) {
+    int n = neighbors[tile.index][direction];
+    return (n == NO_NEIGHBOR) ? nullptr : &tiles[n];
+}
+
+TileNeighbors HexGrid::getAllNeighbors(const Tile& tile) {
+    TileNeighbors result;
+    for (int n : neighbors[tile.index]) {
+        if (n != NO_NEIGHBOR) {
+            result.tiles[result.count++] = &tiles[n];
+        }
+    }
+    return result;
+}
+
+void HexGrid::buildNeighbors() {
+    neighbors.assign(tiles.size(), {});
+
+    for (int row = 0; row < mapSize; ++row) {
+        const int (*offsets)[2] = (row % 2 == 0) ? evenRowOffsets : oddRowOffsets;
+
+        for (int col = 0; col < colsInRow(row); ++col) {
+            std::array<int, 6>& n = neighbors[index(row, col)];
+            for (int d = 0; d < 6; ++d) {
+                int r = row + offsets[d][0];
+                int c = col + offsets[d][1];
+                n[d] = contains(r, c) ? index(r, c) : NO_NEIGHBOR;
+            }
+        }
+    }
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#ifndef HEXGRID_HPP
+#define HEXGRID_HPP
+
+#include <array>
+#include <span>
+#include <vector>
+
+#include "HexCoord.hpp"
+#include "Tile.hpp"
+
+/**
+ * Voisins d'une tile sans allocation : au plus 6 pointeurs, parcourables avec un range-for
+ */
+struct TileNeighbors {
+    std::array<Tile*, 6> tiles{};
+    int count = 0;
+
+    Tile** begin() { return tiles.data(); }
+    Tile** end() { return tiles.data() + count; }
+    int size() const { return count; }
+};
+
+/**
+ * Grille hexagonale dense en lignes décalées (les lignes impaires sont décalées d'une
+ * demi-case et ont une colonne de moins).
+ * Les tiles sont stockées ligne par ligne dans un tableau contigu et la table des
+ * voisins est construite une seule fois par carte : une requête de voisinage n'est
+ * plus qu'une lecture de tableau.
+ */
+class HexGrid {
+public:
+    static constexpr int NO_NEIGHBOR = -1;
+
+    // reconstruit la grille (tiles remises à zéro + table des voisins)
+    void resize(int mapSize);
+    // nombre de tiles d'une grille de mapSize lignes, en 64 bits (aucune allocation)
+    static long long tileCount(int mapSize) {
+        const long long n = mapSize;
+        return (n / 2) * (2 * n - 1) + (n % 2) * n;
+    }
+    void clear();
+
+    int size() const { return mapSize; }
+    int count() const { return static_cast<int>(tiles.size()); }
+    int colsInRow(int row) const { return (row % 2 == 0) ? mapSize : mapSize - 1; }
+    bool contains(int row, int col) const;
+
+    // index dans le tableau contigu (ordre ligne par ligne)
+    int index(int row, int col) const;
+    // index de la première tile de la ligne (rowStart(size()) == count())
+    int rowStart(int row) const;
+    int index(const HexCoord& hc) const;
+
+    Tile& operator[](int index) { return tiles[index]; }
+    const Tile& operator[](int index) const { return tiles[index]; }
+    Tile* at(int row, int col);
+
+    // indices des 6 voisins dans l'ordre de hexNeighbors, NO_NEIGHBOR hors de la carte
+    std::span<const int, 6> neighborIndices(int index) const {
+        return std::span<const int, 6>(neighbors[index]);
+    }
+    Tile* getNeighbor(const Tile& tile, hexNeighbors direction);
+    TileNeighbors getAllNeighbors(const Tile& tile);
+
+    // coordonnées hexCoord.x / hexCoord.y de toutes les tiles, contiguës (pour les bruits en grille)
+    const std::vector<float>& coordsX() const { return xs; }
+    const std::vector<float>& coordsY() const { return ys; }
+
+    std::vector<Tile>::iterator begin() { return tiles.begin(); }
+    std::vector<Tile>::iterator end() { return tiles.end(); }
+    std::vector<Tile>::const_iterator begin() const { return tiles.begin(); }
+    std::vector<Tile>::const_iterator end() const { return tiles.end(); }
+
+private:
+    int mapSize = 0;
+    std::vector<Tile> tiles;
+    std::vector<std::array<int, 6>> neighbors;
+    std::vector<float> xs;
+    std::vector<float> ys;
+
+    void buildNeighbors();
+};
+
+#endif // HEXGRID_HPP
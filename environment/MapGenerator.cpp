@@ -0,0 +1,314 @@
+#include "MapGenerator.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+#include "DistanceField.hpp"
+#include "../configuration.hpp"
+#include "../utils/Noise.hpp"
+
+// nombre de lignes traitées d'un bloc : le découpage est fixe, le résultat ne dépend
+// donc pas du nombre de threads
+static const int rowsPerBlock = 8;
+
+TileLayout TileLayout::forMapSize(int mapSize) {
+    TileLayout layout;
+    layout.h = conf::game_window_height_f / (1.0f + (mapSize - 1) * 0.75f);
+    layout.radius = layout.h / 2.0f;
+    layout.w = std::sqrt(3.f) * layout.radius;
+    return layout;
+}
+
+/* ----- graphe de génération ----- */
+// chaque étape déclare les paramètres qu'elle lit et les étapes dont elle utilise le résultat :
+// une étape n'est recalculée que si l'un de ses paramètres a changé ou si une étape en amont
+// a produit un nouveau résultat depuis son dernier calcul
+const std::vector<MapGenerator::Stage> MapGenerator::stages = {
+    {
+        "Bruit (hauteur, rivières, température)", false, {},
+        [](const MapParams& a, const MapParams& b) {
+            return a.map_size != b.map_size || a.map_seed != b.map_seed
+                || a.map_octaves != b.map_octaves || a.map_persistence != b.map_persistence
+                || a.map_lacunarity != b.map_lacunarity || a.map_frequency != b.map_frequency
+                || a.offsetX != b.offsetX || a.offsetY != b.offsetY
+                || a.flow_mult != b.flow_mult || a.nbVN != b.nbVN;
+        },
+        &MapGenerator::generateNoise
+    },
+    {
+        "Eau, rivières et distance à l'eau", false, {0},
+        [](const MapParams& a, const MapParams& b) {
+            return a.water_threshold != b.water_threshold || a.flow_threshold != b.flow_threshold;
+        },
+        &MapGenerator::generateWater
+    },
+    {
+        "Climat et biomes", false, {1},
+        [](const MapParams&, const MapParams&) { return false; },
+        &MapGenerator::generateClimate
+    },
+    {
+        "Données des tiles", true, {2},
+        [](const MapParams&, const MapParams&) { return false; },
+        &MapGenerator::buildTileInstances
+    },
+};
+
+MapGenerator::MapGenerator(int nbThreads, bool buildRenderData) :
+    pool(std::make_unique<ThreadPool>(nbThreads)), buildRenderData(buildRenderData), states(stages.size()) {}
+
+bool MapGenerator::generate(const MapParams& p, MapFrame& out, const std::function<bool()>& isCancelled) {
+    this->isCancelled = &isCancelled;
+    std::vector<StageReport> report;
+
+    for (size_t i = 0; i < stages.size(); ++i) {
+        const Stage& stage = stages[i];
+        StageState& state = states[i];
+        if (stage.renderData && !buildRenderData) continue;
+
+        std::vector<unsigned int> inputVersions;
+        for (int dependency : stage.dependencies) {
+            inputVersions.push_back(states[dependency].version);
+        }
+
+        bool dirty = !state.params || stage.paramsChanged(*state.params, p) || state.inputVersions != inputVersions;
+
+        double durationMs = 0.0;
+        if (dirty) {
+            auto start = std::chrono::high_resolution_clock::now();
+            (this->*stage.run)(p);
+            auto end = std::chrono::high_resolution_clock::now();
+            durationMs = std::chrono::duration<double, std::milli>(end - start).count();
+
+            if (cancelled()) {
+                // sortie à moitié calculée : l'étape devra être refaite
+                state.params.reset();
+                this->isCancelled = nullptr;
+                return false;
+            }
+
+            state.params = p;
+            state.version++;
+            state.inputVersions = inputVersions;
+        }
+        report.push_back({stage.name, dirty, durationMs});
+    }
+    this->isCancelled = nullptr;
+
+    out.params = p;
+    out.grid = grid;
+    out.distToWater = distToWater;
+    out.statistics = statistics;
+    out.instances = instances;
+    out.attributes = attributes;
+    out.report = std::move(report);
+
+    return true;
+}
+
+bool MapGenerator::cancelled() const {
+    return isCancelled && *isCancelled && (*isCancelled)();
+}
+
+// exécute task(premiere tile, derniere tile) par blocs de lignes, les blocs restants sont sautés si la génération est annulée
+void MapGenerator::forEachRowBlock(const std::function<void(int, int)>& task) {
+    pool->parallelFor(grid.size(), rowsPerBlock, [&](int firstRow, int lastRow) {
+        if (cancelled()) return;
+        task(grid.rowStart(firstRow), grid.rowStart(lastRow));
+    });
+}
+
+/* ------------------------------------------------------------------------ */
+
+// bruits de toute la carte : hauteur, masque des rivières et petit bruit de température
+void MapGenerator::generateNoise(const MapParams& p) {
+    grid.resize(p.map_size);
+
+    const int nbTiles = grid.count();
+    heightNoise.resize(nbTiles);
+    flowNoise.resize(nbTiles);
+    temperatureNoise.resize(nbTiles);
+
+    // table de permutation construite une seule fois par seed
+    std::shared_ptr<const Noise> noise = Noise::forSeed(p.map_seed);
+
+    const float* gridX = grid.coordsX().data();
+    const float* gridY = grid.coordsY().data();
+
+    NoiseParams heightParams;
+    heightParams.offsetX = p.offsetX;
+    heightParams.offsetY = p.offsetY;
+    heightParams.frequency = p.map_frequency;
+    heightParams.octaves = p.map_octaves;
+    heightParams.persistence = p.map_persistence;
+    heightParams.lacunarity = p.map_lacunarity;
+
+    NoiseParams flowParams = heightParams;
+    flowParams.frequencyMult = static_cast<float>(p.flow_mult);
+
+    // température : même fréquence que la hauteur mais en miroir
+    NoiseParams temperatureParams = heightParams;
+    temperatureParams.scale = -1.0f;
+
+    forEachRowBlock([&](int first, int last) {
+        const int n = last - first;
+
+        // hauteur : tout le bruit fractal du bloc en un appel
+        noise->fractalNoiseGrid(gridX + first, gridY + first, &heightNoise[first], n, heightParams);
+        noise->fractalNoiseGrid(gridX + first, gridY + first, &temperatureNoise[first], n, temperatureParams);
+
+        // masque des rivières : somme de nbVN value noise
+        std::vector<float> valueNoise(n);
+        std::fill(flowNoise.begin() + first, flowNoise.begin() + last, 0.0f);
+        NoiseParams params = flowParams;
+        for(int v = 1; v <= p.nbVN; v++) {
+            params.scale = static_cast<float>(v);
+            noise->valueNoiseGrid(gridX + first, gridY + first, valueNoise.data(), n, params);
+            for (int i = 0; i < n; ++i) {
+                flowNoise[first + i] += valueNoise[i] * v;
+            }
+        }
+    });
+}
+
+// eau (seuil d'eau ou masque des rivières), rivières puis distance à l'eau
+void MapGenerator::generateWater(const MapParams& p) {
+    forEachRowBlock([&](int first, int last) {
+        for (int i = first; i < last; ++i) {
+            Tile& tile = grid[i];
+            tile.height = heightNoise[i];
+            tile.flow = flowNoise[i];
+            tile.biome = Biome();
+            tile.isWater = false;
+
+            // Biome d'eau ?
+            if (tile.height < p.water_threshold || tile.flow < p.flow_threshold) {
+                tile.setBiomeAquatic();
+            }
+        }
+    });
+
+    generateRivers(p);
+    smoothAquatic();
+
+    distanceField::computeDistToWater(grid, distToWater);
+}
+
+// tracé des rivières depuis les sources : séquentiel, une rivière peut traverser toute la carte
+void MapGenerator::generateRivers(const MapParams& p) {
+    std::vector<Tile*> waterTiles;
+
+    for (Tile& tile : grid) {
+        if (tile.biome.biomeType == BiomeType::Water && tile.height > p.water_threshold) {
+            waterTiles.push_back(&tile);
+        }
+    }
+
+    for (Tile* tile : waterTiles) {
+        createRivers(*tile);
+    }
+}
+
+// une tile entourée d'eau devient aquatique
+// les voisins sont lus dans l'état d'avant la passe pour que l'ordre de traitement ne compte pas
+void MapGenerator::smoothAquatic() {
+    const int nbTiles = grid.count();
+    std::vector<char> wasWater(nbTiles);
+    for (int i = 0; i < nbTiles; ++i) {
+        wasWater[i] = grid[i].biome.biomeType == BiomeType::Water;
+    }
+
+    forEachRowBlock([&](int first, int last) {
+        for (int i = first; i < last; ++i) {
+            int nbAquaticNeighbors = 0;
+            for (int n : grid.neighborIndices(i)) {
+                if (n != HexGrid::NO_NEIGHBOR && wasWater[n]) nbAquaticNeighbors++;
+            }
+            if(nbAquaticNeighbors > 4) grid[i].setBiomeAquatic();
+        }
+    });
+}
+
+// climat et biome de chaque tile, les statistiques de la carte sont remplies au passage
+void MapGenerator::generateClimate(const MapParams& p) {
+    const int nbBlocks = (grid.size() + rowsPerBlock - 1) / rowsPerBlock;
+    blockStatistics.assign(nbBlocks, MapStatistics());
+
+    forEachRowBlock([&](int first, int last) {
+        MapStatistics& blockStats = blockStatistics[static_cast<int>(grid[first].hexCoord.y) / rowsPerBlock];
+
+        for (int i = first; i < last; ++i) {
+            Tile& tile = grid[i];
+
+            // Déterminer le biome
+            tile.computeClimate(temperatureNoise[i], distToWater[i], p.map_size);
+            if(tile.biome.biomeType != BiomeType::Water) {
+                tile.define_biome();
+            }
+            blockStats.add(tile);
+        }
+    });
+
+    // fusion dans l'ordre des blocs : même résultat quel que soit le nombre de threads
+    statistics = MapStatistics();
+    for (const MapStatistics& blockStats : blockStatistics) {
+        statistics.merge(blockStats);
+    }
+}
+
+// une instance par tile : position, hauteur, rayon et couleur selon le mode d'affichage
+// (le modèle de tile n'est envoyé qu'une fois à OpenGL, les bords sont gérés dans le vertex shader)
+void MapGenerator::buildTileInstances(const MapParams& p) {
+    const TileLayout layout = TileLayout::forMapSize(p.map_size);
+    const float h = layout.h;
+    const float radius = layout.radius;
+    const float w = layout.w;
+
+    instances.resize(grid.count());
+    attributes.resize(grid.count());
+
+    forEachRowBlock([&](int first, int last) {
+        for (int i = first; i < last; ++i) {
+            const Tile& tile = grid[i];
+
+            // col * w (+ w/2 sur les lignes impaires) == gridX * w
+            float x = tile.hexCoord.x * w;
+            float y = tile.hexCoord.y * (h * 0.75f);
+            instances[i].position = glm::vec2(x/conf::model_size_div, y/conf::model_size_div);
+            instances[i].radius = radius/conf::model_size_div;
+
+            // la couleur et la hauteur affichées sont choisies par le shader (mode tile_color)
+            attributes[i].height = tile.height;
+            attributes[i].temperature = tile.temperature;
+            attributes[i].precipitation = tile.precipitation;
+            attributes[i].biome = static_cast<float>(tile.biome.biomeType);
+        }
+    });
+}
+
+void MapGenerator::createRivers(Tile& tile) {
+    Tile* lowest = lowestNeighbor(tile);
+    if (!lowest) return;
+
+    if (lowest->height >= tile.height)
+        return; // pas plus bas → fin du fleuve
+
+    lowest->setBiomeAquatic(); // devient rivière
+
+    createRivers(*lowest);
+}
+
+Tile* MapGenerator::lowestNeighbor(Tile& tile) {
+    Tile* lowest = nullptr;
+
+    for (Tile* n : grid.getAllNeighbors(tile)) {
+        if (!lowest || n->height < lowest->height) {
+            lowest = n;
+        }
+    }
+
+    if(!lowest || lowest->biome.biomeType == BiomeType::Water) return nullptr;
+
+    return lowest;
+}
\ No newline at end of file
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "HexGrid.hpp"
+#include "MapParams.hpp"
+#include "MapStatistics.hpp"
+#include "TileRenderData.hpp"
+#include "../utils/ThreadPool.hpp"
+
+// étape d'une génération : recalculée ou reprise du cache, et durée
+struct StageReport {
+    const char* name;
+    bool ran;
+    double durationMs;
+};
+
+// dimensions d'une tile pour une carte de mapSize de côté (avant division par model_size_div)
+struct TileLayout {
+    float h;
+    float radius;
+    float w;
+
+    static TileLayout forMapSize(int mapSize);
+};
+
+// résultat complet d'une génération, prêt à être installé par le thread de rendu
+struct MapFrame {
+    MapParams params;
+    HexGrid grid;
+    std::vector<int> distToWater;
+    MapStatistics statistics;                // remplies pendant le calcul du climat
+    std::vector<TileInstance> instances;     // une instance du modèle de tile par tile, pas encore envoyées à OpenGL
+    std::vector<TileAttributes> attributes;  // valeurs de chaque tile pour le shader, indexées comme instances
+    std::vector<StageReport> report;
+};
+
+/**
+ * Génère la carte par étapes (graphe de génération) sans toucher aux globales de map :
+ * peut donc tourner sur un autre thread que le rendu.
+ * Les sorties de chaque étape sont gardées entre deux appels, seules les étapes
+ * invalidées par les nouveaux paramètres sont recalculées.
+ * Sans buildRenderData (version sans affichage) les étapes qui ne servent qu'au rendu
+ * sont sautées et instances / attributes restent vides.
+ */
+class MapGenerator {
+public:
+    explicit MapGenerator(int nbThreads = 0, bool buildRenderData = true);
+
+    /**
+     * Calcule la carte pour p et la copie dans out.
+     * isCancelled est consulté entre les blocs : s'il devient vrai la génération
+     * s'arrête, retourne false et out n'est pas modifié.
+     */
+    bool generate(const MapParams& p, MapFrame& out, const std::function<bool()>& isCancelled = {});
+
+private:
+    struct Stage {
+        const char* name;
+        bool renderData; // sortie utilisée seulement par le rendu
+        std::vector<int> dependencies; // indices des étapes en amont (toujours avant dans la liste)
+        bool (*paramsChanged)(const MapParams& before, const MapParams& now);
+        void (MapGenerator::*run)(const MapParams& p);
+    };
+
+    // état du cache d'une étape
+    struct StageState {
+        std::optional<MapParams> params;         // paramètres du dernier calcul complet
+        unsigned int version = 0;                // incrémenté à chaque calcul complet
+        std::vector<unsigned int> inputVersions; // versions des étapes en amont utilisées
+    };
+
+    static const std::vector<Stage> stages;
+
+    std::unique_ptr<ThreadPool> pool;
+    bool buildRenderData;
+    std::vector<StageState> states;
+    const std::function<bool()>* isCancelled = nullptr;
+
+    // sorties des étapes
+    HexGrid grid;
+    std::vector<float> heightNoise;
+    std::vector<float> flowNoise;
+    std::vector<float> temperatureNoise;
+    std::vector<int> distToWater;
+    MapStatistics statistics;
+    std::vector<MapStatistics> blockStatistics; // une par bloc de lignes, fusionnées dans l'ordre
+    std::vector<TileInstance> instances;
+    std::vector<TileAttributes> attributes;
+
+    bool cancelled() const;
+    void forEachRowBlock(const std::function<void(int, int)>& task);
+
+    void generateNoise(const MapParams& p);
+    void generateWater(const MapParams& p);
+    void generateRivers(const MapParams& p);
+    void smoothAquatic();
+    void generateClimate(const MapParams& p);
+    void buildTileInstances(const MapParams& p);
+
+    void createRivers(Tile& tile);
+    Tile* lowestNeighbor(Tile& tile);
+};
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "../gameParam.hpp"
+
+/**
+ * Copie des paramètres de gameParam utilisés par la génération de la carte.
+ * La génération travaille sur cette copie : comparer deux copies indique quelles
+ * étapes doivent être recalculées.
+ * Les paramètres d'affichage (tile_color, min_temp, max_temp, max_precipitation) n'en font
+ * pas partie : ils sont envoyés au shader en uniforms sans régénérer la carte.
+ */
+struct MapParams {
+    /* carte */
+    int map_size;
+    int map_seed;
+    int map_octaves;
+    float map_persistence;
+    float map_lacunarity;
+    float map_frequency;
+    int offsetX;
+    int offsetY;
+
+    /* Aquatique */
+    float water_threshold;
+    float flow_threshold;
+    int flow_mult;
+    int nbVN;
+
+    bool operator==(const MapParams& other) const = default;
+
+    static MapParams current() {
+        MapParams p;
+        p.map_size = gameParam::map_size;
+        p.map_seed = gameParam::map_seed;
+        p.map_octaves = gameParam::map_octaves;
+        p.map_persistence = gameParam::map_persistence;
+        p.map_lacunarity = gameParam::map_lacunarity;
+        p.map_frequency = gameParam::map_frequency;
+        p.offsetX = gameParam::offsetX;
+        p.offsetY = gameParam::offsetY;
+
+        p.water_threshold = gameParam::water_threshold;
+        p.flow_threshold = gameParam::flow_threshold;
+        p.flow_mult = gameParam::flow_mult;
+        p.nbVN = gameParam::nbVN;
+
+        return p;
+    }
+};
\ No newline at end of file
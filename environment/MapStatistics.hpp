@@ -0,0 +1,54 @@
+#pragma once
+
+#include "Tile.hpp"
+#include "../utils/Statistics.hpp"
+
+// statistiques d'une valeur des tiles : min / max / moyenne, quantiles et histogramme
+struct ValueStatistics {
+    static constexpr int NB_BINS = 32;
+
+    RunningStats stats;
+    TDigest quantiles;
+    Histogram<NB_BINS> histogram;
+
+    ValueStatistics(float low, float high) : histogram(low, high) {}
+
+    void add(float value) {
+        stats.add(value);
+        quantiles.add(value);
+        histogram.add(value);
+    }
+
+    void merge(const ValueStatistics& other) {
+        stats.merge(other.stats);
+        quantiles.merge(other.quantiles);
+        histogram.merge(other.histogram);
+    }
+};
+
+/**
+ * Statistiques de la carte, remplies par la génération au moment où le climat de chaque
+ * tile est calculé : l'export et l'affichage ne repassent pas sur la carte.
+ * Intervalles des histogrammes fixes (valeurs possibles de la génération) pour que les
+ * blocs puissent être fusionnés.
+ */
+struct MapStatistics {
+    IdCounter<static_cast<int>(BiomeType::None) + 1> biomes;
+    ValueStatistics height{0.0f, 1.0f};
+    ValueStatistics temperature{-60.0f, 40.0f};
+    ValueStatistics precipitation{0.0f, 600.0f};
+
+    void add(const Tile& tile) {
+        biomes.add(static_cast<int>(tile.biome.biomeType));
+        height.add(tile.height);
+        temperature.add(tile.temperature);
+        precipitation.add(tile.precipitation);
+    }
+
+    void merge(const MapStatistics& other) {
+        biomes.merge(other.biomes);
+        height.merge(other.height);
+        temperature.merge(other.temperature);
+        precipitation.merge(other.precipitation);
+    }
+};
\ No newline at end of file
@@ -0,0 +1,151 @@
+#include "ResourceFields.hpp"
+
+#include <algorithm>
+#include <limits>
+
+#include "DistanceField.hpp"
+#include "../utils/Simd.hpp"
+
+#if SIMD_HAS_AVX2
+#include <immintrin.h>
+#endif
+
+// masse de plantes qui repousse même sur une tile vidée
+static constexpr float PLANT_SEED = 1.0f;
+// borne de la capacité dans le remplissage : water_refill = 0 donnerait 0 * inf = NaN sur l'eau
+static constexpr float REFILL_CAP = std::numeric_limits<float>::max();
+
+// masse critique de plantes par biome (indexée par BiomeType)
+static constexpr float plantCapacityByBiome[] = {
+    20.0f,  // Water (algues)
+    100.0f, // Tropical_Rainforest
+    50.0f,  // Tropical_Savanna
+    90.0f,  // Temperate_Rainforest
+    70.0f,  // Temperate_Deciduous_Forest
+    60.0f,  // Temperate_Grassland
+    40.0f,  // Taiga
+    5.0f,   // Desert
+    15.0f,  // Tundra
+    0.0f,   // Polar
+    0.0f,   // None
+};
+
+void ResourceFields::build(const HexGrid& grid, const std::vector<int>& distToWater, const ResourceParams& p) {
+    const int nbTiles = grid.count();
+    for (auto& column : values) column.resize(nbTiles);
+    computeCapacities(grid, distToWater, p);
+
+    float* plant = field(Resource::Plantfood);
+    float* meat = field(Resource::Meat);
+    float* water = field(Resource::Water);
+
+    for (int i = 0; i < nbTiles; ++i) {
+        plant[i] = plantCap[i];
+        meat[i] = 0.0f;
+        water[i] = waterCap[i];
+    }
+}
+
+void ResourceFields::computeCapacities(const HexGrid& grid, const std::vector<int>& distToWater, const ResourceParams& p) {
+    const int nbTiles = grid.count();
+    plantCap.resize(nbTiles);
+    plantInvCap.resize(nbTiles);
+    meatKeep.resize(nbTiles);
+    waterCap.resize(nbTiles);
+
+    plantGrowth = p.plant_growth;
+    waterRefill = p.water_refill;
+
+    for (int i = 0; i < nbTiles; ++i) {
+        const Tile& tile = grid[i];
+
+        plantCap[i] = plantCapacityByBiome[static_cast<int>(tile.biome.biomeType)];
+        plantInvCap[i] = (plantCap[i] > 0.0f) ? 1.0f / plantCap[i] : 0.0f;
+
+        // la décomposition accélère avec la chaleur et l'humidité
+        float decay = p.meat_decay * (1.0f + std::max(0.0f, tile.temperature) / 20.0f + tile.precipitation / 300.0f);
+        meatKeep[i] = 1.0f - std::min(1.0f, decay);
+
+        if (tile.isWater) {
+            waterCap[i] = std::numeric_limits<float>::infinity();
+        } else if (distToWater[i] == distanceField::NO_WATER) {
+            waterCap[i] = 0.0f;
+        } else {
+            waterCap[i] = p.water_scale / static_cast<float>(1 + distToWater[i]);
+        }
+    }
+}
+
+/* ----- update ----- */
+
+static void updateScalar(float* plant, float* meat, float* water,
+                         const float* plantCap, const float* plantInvCap, const float* meatKeep, const float* waterCap,
+                         float plantGrowth, float waterRefill, int begin, int end) {
+    for (int i = begin; i < end; ++i) {
+        // croissance logistique vers plantCap
+        float grown = plant[i] + plantGrowth * (plant[i] + PLANT_SEED) * (1.0f - plant[i] * plantInvCap[i]);
+        plant[i] = std::min(grown, plantCap[i]);
+
+        meat[i] = meat[i] * meatKeep[i];
+
+        // waterCap infini sur l'eau : inf + fini = inf, min reste infini
+        water[i] = std::min(water[i] + waterRefill * std::min(waterCap[i], REFILL_CAP), waterCap[i]);
+    }
+}
+
+#if SIMD_HAS_AVX2
+SIMD_TARGET_AVX2
+static int updateAvx2(float* plant, float* meat, float* water,
+                      const float* plantCap, const float* plantInvCap, const float* meatKeep, const float* waterCap,
+                      float plantGrowth, float waterRefill, int begin, int end) {
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 seed = _mm256_set1_ps(PLANT_SEED);
+    const __m256 growth = _mm256_set1_ps(plantGrowth);
+    const __m256 refill = _mm256_set1_ps(waterRefill);
+    const __m256 refillCap = _mm256_set1_ps(REFILL_CAP);
+
+    int i = begin;
+    for (; i + 8 <= end; i += 8) {
+        __m256 p = _mm256_loadu_ps(plant + i);
+        __m256 room = _mm256_sub_ps(one, _mm256_mul_ps(p, _mm256_loadu_ps(plantInvCap + i)));
+        __m256 grown = _mm256_add_ps(p, _mm256_mul_ps(_mm256_mul_ps(growth, _mm256_add_ps(p, seed)), room));
+        _mm256_storeu_ps(plant + i, _mm256_min_ps(grown, _mm256_loadu_ps(plantCap + i)));
+
+        _mm256_storeu_ps(meat + i, _mm256_mul_ps(_mm256_loadu_ps(meat + i), _mm256_loadu_ps(meatKeep + i)));
+
+        __m256 cap = _mm256_loadu_ps(waterCap + i);
+        __m256 w = _mm256_add_ps(_mm256_loadu_ps(water + i), _mm256_mul_ps(refill, _mm256_min_ps(cap, refillCap)));
+        _mm256_storeu_ps(water + i, _mm256_min_ps(w, cap));
+    }
+    return i;
+}
+#endif
+
+std::array<const float*, ResourceFields::SAVED_ARRAYS> ResourceFields::savedArrays() const {
+    return {values[0].data(), values[1].data(), values[2].data()};
+}
+
+void ResourceFields::restore(const HexGrid& grid, const std::vector<int>& distToWater,
+                             const std::array<const float*, SAVED_ARRAYS>& arrays, const ResourceParams& p) {
+    for (int r = 0; r < RESOURCE_COUNT; ++r) {
+        values[r].assign(arrays[r], grid.count());
+    }
+    computeCapacities(grid, distToWater, p);
+}
+
+void ResourceFields::update(int begin, int end) {
+    float* plant = field(Resource::Plantfood);
+    float* meat = field(Resource::Meat);
+    float* water = field(Resource::Water);
+
+    int done = begin;
+#if SIMD_HAS_AVX2
+    if (simd::hasAvx2()) {
+        done = updateAvx2(plant, meat, water, plantCap.data(), plantInvCap.data(), meatKeep.data(), waterCap.data(),
+                          plantGrowth, waterRefill, begin, end);
+    }
+#endif
+    // reste (ou tout si pas d'AVX2)
+    updateScalar(plant, meat, water, plantCap.data(), plantInvCap.data(), meatKeep.data(), waterCap.data(),
+                 plantGrowth, waterRefill, done, end);
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#ifndef RESOURCEFIELDS_HPP
+#define RESOURCEFIELDS_HPP
+
+#include <array>
+#include <vector>
+
+#include "HexGrid.hpp"
+#include "../gameParam.hpp"
+#include "../utils/AlignedArray.hpp"
+
+// ressources d'une tile (__consigne__.txt)
+enum class Resource {
+    Plantfood, // pousse jusqu'à une masse critique qui dépend du biome
+    Meat,      // déposée par les morts, se décompose selon la température et les précipitations
+    Water,     // infinie sur l'eau, de moins en moins loin des rivières
+    Count
+};
+
+inline constexpr int RESOURCE_COUNT = static_cast<int>(Resource::Count);
+
+// copie des paramètres de gameParam utilisés par les ressources
+struct ResourceParams {
+    float plant_growth;
+    float meat_decay;
+    float water_refill;
+    float water_scale;
+
+    bool operator==(const ResourceParams& other) const = default;
+
+    static ResourceParams current() {
+        ResourceParams p;
+        p.plant_growth = gameParam::plant_growth;
+        p.meat_decay = gameParam::meat_decay;
+        p.water_refill = gameParam::water_refill;
+        p.water_scale = gameParam::water_scale;
+        return p;
+    }
+};
+
+/**
+ * Ressources de toutes les tiles en tableaux denses indexés comme la HexGrid.
+ * Les capacités et vitesses propres à chaque tile (biome, climat, distance à l'eau) sont
+ * calculées une fois par carte dans build, update fait ensuite avancer les trois
+ * ressources d'un tick (8 tiles par instruction en AVX2, version scalaire identique).
+ * Pendant la phase des créatures, Simulation::act écrit directement dans field() : chaque
+ * bloc de tiles ne touche qu'à ses propres tiles, il n'y a donc pas de conflit entre threads.
+ */
+class ResourceFields {
+public:
+    void build(const HexGrid& grid, const std::vector<int>& distToWater, const ResourceParams& p);
+
+    int count() const { return static_cast<int>(values[0].size()); }
+
+    // un tick de pousse / décomposition / remplissage sur les tiles [begin, end)
+    void update(int begin, int end);
+
+    float* field(Resource r) { return values[static_cast<int>(r)].data(); }
+    const float* field(Resource r) const { return values[static_cast<int>(r)].data(); }
+    float get(int tile, Resource r) const { return values[static_cast<int>(r)][tile]; }
+
+    // masse critique des plantes, réserve d'eau (infinie sur l'eau)
+    const float* plantCapacity() const { return plantCap.data(); }
+    const float* waterCapacity() const { return waterCap.data(); }
+
+    /**
+     * Snapshots : seules les ressources sont sauvées (count() valeurs par tableau), capacités
+     * et vitesses sont recalculées comme dans build depuis la carte et les paramètres actuels
+     * (qui peuvent différer de ceux du snapshot). L'eau au-dessus d'une capacité réduite
+     * redescend au tick suivant.
+     */
+    static constexpr int SAVED_ARRAYS = RESOURCE_COUNT;
+    std::array<const float*, SAVED_ARRAYS> savedArrays() const;
+    void restore(const HexGrid& grid, const std::vector<int>& distToWater,
+                 const std::array<const float*, SAVED_ARRAYS>& arrays, const ResourceParams& p);
+
+private:
+    AlignedArray<float> values[RESOURCE_COUNT];
+    AlignedArray<float> plantCap;
+    AlignedArray<float> plantInvCap;  // 1 / plantCap, 0 si plantCap == 0
+    AlignedArray<float> meatKeep;     // part de viande restante après un tick
+    AlignedArray<float> waterCap;
+    float plantGrowth = 0.0f;
+    float waterRefill = 0.0f;
+
+    // capacités et vitesses propres à chaque tile, ressources inchangées
+    void computeCapacities(const HexGrid& grid, const std::vector<int>& distToWater, const ResourceParams& p);
+};
+
+#endif // RESOURCEFIELDS_HPP
@@ -4,72 +4,35 @@
 #include <limits>
 #include <algorithm>
 
-#include "../gameParam.hpp"
 #include "../utils/mathUtils.hpp"
-#include "../utils/Noise.hpp"
-#include "map.hpp"
-
-Noise perlin = Noise();
+#include "DistanceField.hpp"
 
 float Tile::local_evap(float temp) {
     return MathUtils::clamp((temp - (-37.0f)) / (28.0f - (-37.0f)), 0.0f, 1.0f);
 }
 
-static inline int hexDistance(const Tile* a, const Tile* b) {
-    int ax = a->hexCoord.x;
-    int az = a->hexCoord.y;
-    int ay = -ax - az;
-
-    int bx = b->hexCoord.x;
-    int bz = b->hexCoord.y;
-    int by = -bx - bz;
-
-    return (std::abs(ax - bx) + std::abs(ay - by) + std::abs(az - bz)) / 2;
-}
-
-float Tile::getDistToOcean(const std::vector<Tile*>& allWaterTiles) {
-    // Si la tile elle-même est de l'eau
-    if (biome.biomeType == BiomeType::Water)
-        return 0.0f;
-
-    // Sécurité si jamais la liste est vide
-    if (allWaterTiles.empty())
+float Tile::getDistToOcean(int distToWater) {
+    // aucune eau sur la carte
+    if (distToWater == distanceField::NO_WATER)
         return static_cast<float>(std::numeric_limits<int>::max());
 
-    int minDist = std::numeric_limits<int>::max();
-
-    for (const Tile* water : allWaterTiles) {
-        if (!water) continue;
-
-        int d = hexDistance(this, water);
-        minDist = std::min(minDist, d);
-    }
-
-    return static_cast<float>(minDist);
+    return static_cast<float>(distToWater);
 }
 
-void Tile::computeClimate(const std::vector<Tile*>& allWaterTiles) {
-    perlin.initPerm(gameParam::map_seed);
-
-    float latitude_norm = abs((((float)this->hexCoord.y / (float)(gameParam::map_size-1)) - 0.5f) * 2);
+void Tile::computeClimate(float noiseValue, int distToWater, int mapSize) {
+    float latitude_norm = abs((((float)this->hexCoord.y / (float)(mapSize-1)) - 0.5f) * 2);
 
     float T_equator = 28.0f;
     float lat_temp_gradient = 40.0f; // donne froid aux pôles
     float lapse_rate = 25.0f; // per altitude unit (si altitude normalisée 0..1)
-    float noiseValue = perlin.fractalNoise(
-        (gameParam::offsetX + this->hexCoord.x * gameParam::map_frequency) * -1,
-        (gameParam::offsetY + this->hexCoord.y * gameParam::map_frequency) * -1,
-        gameParam::map_octaves,
-        gameParam::map_persistence,
-        gameParam::map_lacunarity
-    ); //petit bruit ±2°C
+    // noiseValue dans [0, 1] -> petit bruit ±2°C
     float noise = noiseValue * 4 - 2;
     this->temperature = T_equator - (latitude_norm * lat_temp_gradient) - (this->height * lapse_rate) + noise;
 
-    float map_diagonal = sqrt(2 * pow(gameParam::map_size, 2)); // gameParam::map_size*gameParam::map_size + gameParam::map_size*gameParam::map_size
+    float map_diagonal = sqrt(2 * pow(mapSize, 2)); // mapSize*mapSize + mapSize*mapSize
     float decay_factor = 2.0f;
     float decay = map_diagonal * decay_factor;
-    float moisture_ocean = exp(-getDistToOcean(allWaterTiles) / decay);
+    float moisture_ocean = exp(-getDistToOcean(distToWater) / decay);
     float C = 1.2f;
     float D = 0.06f;
     float moisture_capacity = C * exp(D * this->temperature);
@@ -83,6 +46,7 @@ void Tile::computeClimate(const std::vector<Tile*>& allWaterTiles) {
 
 void Tile::setBiomeAquatic() {
     this->biome = getBiome(BiomeType::Water);
+    this->isWater = true;
 }
 
 void Tile::define_biome() {
@@ -135,50 +99,4 @@ void Tile::define_biome() {
     else {
         this->biome = getBiome(BiomeType::Polar);
     }
-}
-
-Tile* Tile::getNeighbors(hexNeighbors neighbors_direction) {
-    HexCoord coord;
-    switch (neighbors_direction) {
-        case hexNeighbors::Est:
-            coord.x = this->hexCoord.x + 1.0f;
-            coord.y = this->hexCoord.y;
-            break;
-        case hexNeighbors::Nord_Est:
-            coord.x = this->hexCoord.x + 0.5f;
-            coord.y = this->hexCoord.y - 1.0f;
-            break;
-        case hexNeighbors::Nord_Ouest:
-            coord.x = this->hexCoord.x + 0.5f;
-            coord.y = this->hexCoord.y - 1.0f;
-            break;
-        case hexNeighbors::Ouest:
-            coord.x = this->hexCoord.x - 1.0f;
-            coord.y = this->hexCoord.y;
-            break;
-        case hexNeighbors::Sud_Ouest:
-            coord.x = this->hexCoord.x + 0.5f;
-            coord.y = this->hexCoord.y + 1.0f;
-            break;
-        case hexNeighbors::Sud_Est:
-            coord.x = this->hexCoord.x + 0.5f;
-            coord.y = this->hexCoord.y + 1.0f;
-            break;
-    }
-
-    auto it = map::hexmap.find(coord);
-    if (it != map::hexmap.end()) {
-        return &it->second;
-    }
-    return nullptr;
-}
-
-std::vector<Tile*> Tile::getAllNeighbors() {
-    std::vector<Tile*> neighbors;
-    for (int i = 0; i < 6; ++i) {
-        if(Tile* tile = getNeighbors(static_cast<hexNeighbors>(i))) {
-            neighbors.push_back(tile);
-        }
-    }
-    return neighbors;
 }
\ No newline at end of file
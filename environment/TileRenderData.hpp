@@ -0,0 +1,23 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+/**
+ * Données par tile préparées pour le rendu par la génération.
+ * Simples valeurs (aucun appel OpenGL) : la génération reste utilisable sans contexte graphique.
+ */
+
+// données par instance d'une tile (rendu instancié du modèle de tile)
+struct TileInstance {
+    glm::vec2 position; // x, z du centre
+    float radius;
+};
+
+// valeurs d'une tile lues par le shader (texture buffer, une texel RGBA32F par tile)
+// la couleur et la hauteur affichées en sont déduites selon le mode d'affichage
+struct TileAttributes {
+    float height;
+    float temperature;
+    float precipitation;
+    float biome; // BiomeType
+};
\ No newline at end of file
@@ -1,175 +1,125 @@
-#include <cmath>
 #include "map.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+#include "MapParams.hpp"
 #include "../gameParam.hpp"
 #include "../configuration.hpp"
-#include "../utils/Noise.hpp"
-#include "../environment/hexCoord.hpp"
-#include "../utils/mathUtils.hpp"
-#include "../object/tileModel.hpp"
+#include "../rendering/tileRenderer.hpp"
+
+/**
+ * Génération en arrière-plan :
+ * le thread de génération calcule dans son propre MapGenerator (qui garde le cache des étapes)
+ * puis dépose la carte terminée dans ready, le thread de rendu la récupère dans updateHexmap.
+ * Seul l'envoi à OpenGL reste sur le thread de rendu.
+ */
+namespace {
+    struct GenerationWorker {
+        std::thread thread;
+        std::mutex mutex;
+        std::condition_variable wakeUp;
+
+        std::optional<MapParams> pending;  // dernière demande pas encore commencée
+        std::unique_ptr<MapFrame> ready;   // dernière carte terminée pas encore installée
+        std::atomic<unsigned int> requestId{0};
+        std::atomic<bool> stopping{false};
+        std::atomic<bool> busy{false};
+    };
+
+    GenerationWorker worker;
+}
 
-// Perlin pour hauteur
-Noise noise = Noise();
+static void workerLoop() {
+    MapGenerator generator(gameParam::nb_threads);
+
+    while (true) {
+        MapParams p;
+        unsigned int job;
+        {
+            std::unique_lock<std::mutex> lock(worker.mutex);
+            worker.wakeUp.wait(lock, [] { return worker.stopping || worker.pending; });
+            if (worker.stopping) return;
+
+            p = *worker.pending;
+            worker.pending.reset();
+            job = worker.requestId;
+            worker.busy = true;
+        }
 
-void createRivers(Tile& tile);
-Tile* lowestNeighbor(Tile& tile);
+        // annulation coopérative : une demande plus récente ou l'arrêt du programme
+        auto frame = std::make_unique<MapFrame>();
+        bool done = generator.generate(p, *frame, [job] {
+            return worker.stopping || worker.requestId != job;
+        });
 
-void createHexmap() {
-    map::hexmap.clear();
-    map::hexmap_drawable.clear();
-    
-    // créer les hexagones
-    const float h = conf::game_window_height_f / (1.0f + (gameParam::map_size - 1) * 0.75f);
-    const float radius = h / 2.0f;
-    const float w = std::sqrt(3.f) * radius;
-
-    // Centrer la caméra
-    float centerX = (gameParam::map_size * w) / 2.0f / conf::model_size_div;
-    float centerZ = ((gameParam::map_size - 1) * (h * 0.75f)) / 2.0f / conf::model_size_div;
-    gameUtils::cam.target = glm::vec3(centerX, 0.0f, centerZ);
-    
-    noise.initPerm(gameParam::map_seed);
-
-    /* ----- génération des tiles ----- */
-    for (int row = 0; row < gameParam::map_size; ++row) {
-        int colsInRow = (row % 2 == 0) ? gameParam::map_size : gameParam::map_size - 1;
-
-        for (int col = 0; col < colsInRow; ++col) {
-            float gridX = col + ((row % 2) ? 0.5f : 0.0f);
-            float gridY = row;
-            HexCoord hc{gridX, gridY};
-            
-            float height = noise.fractalNoise(
-                gameParam::offsetX + gridX * gameParam::map_frequency,
-                gameParam::offsetY + gridY * gameParam::map_frequency,
-                gameParam::map_octaves,
-                gameParam::map_persistence,
-                gameParam::map_lacunarity
-            );
-
-            // Créer la tuile
-            Tile tile;
-            tile.hexCoord = hc;
-            tile.height = height;
-            
-            // Biome d'eau ?
-            double value = 0.0f;
-            for(int p = 1; p <= gameParam::nbVN; p++) {
-                double v = noise.valueNoise(
-                    (gameParam::offsetX + gridX * gameParam::map_frequency * gameParam::flow_mult) * p,
-                    (gameParam::offsetY + gridY * gameParam::map_frequency * gameParam::flow_mult) * p
-                );
-                value += v * p;
+        {
+            std::lock_guard<std::mutex> lock(worker.mutex);
+            if (done) {
+                worker.ready = std::move(frame);
             }
-
-            if (tile.height < gameParam::water_threshold || value < gameParam::flow_threshold) {
-                tile.setBiomeAquatic();
-            }
-            
-            map::hexmap[hc] = tile;
+            worker.busy = static_cast<bool>(worker.pending);
         }
     }
+}
 
-    /* ----- rivières ----- */
-    std::vector<Tile*> waterTiles;
-
-    for (auto& [coord, tile] : map::hexmap) {
-        if (tile.biome.biomeType == BiomeType::Water && tile.height > gameParam::water_threshold) {
-            waterTiles.push_back(&tile);
-        }
-    }
+void createHexmap() {
+    std::lock_guard<std::mutex> lock(worker.mutex);
 
-    for (Tile* tile : waterTiles) {
-        createRivers(*tile);
+    if (!worker.thread.joinable()) {
+        worker.stopping = false;
+        worker.thread = std::thread(workerLoop);
     }
 
-    waterTiles.clear();
-    for (auto& [coord, tile] : map::hexmap) {
-        int nbAquaticNeighbors = 0;
-        for (Tile* n : tile.getAllNeighbors()) {
-            if (n->biome.biomeType == BiomeType::Water) nbAquaticNeighbors++;
-        }
-        if(nbAquaticNeighbors > 4) tile.setBiomeAquatic();
+    worker.pending = MapParams::current();
+    worker.requestId++;
+    worker.busy = true;
+    worker.wakeUp.notify_one();
+}
 
-        if (tile.biome.biomeType == BiomeType::Water) {
-            waterTiles.push_back(&tile);
-        }
+bool updateHexmap() {
+    std::unique_ptr<MapFrame> frame;
+    {
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        frame = std::move(worker.ready);
     }
+    if (!frame) return false;
 
-    /* ----- hexagones ----- */
-    for (int row = 0; row < gameParam::map_size; ++row) {
-        int colsInRow = (row % 2 == 0) ? gameParam::map_size : gameParam::map_size - 1;
-
-        for (int col = 0; col < colsInRow; ++col) {
-            float x = col * w + ((row % 2) ? w / 2.0f : 0.0f);
-            float y = row * (h * 0.75f);
-
-            float gridX = col + ((row % 2) ? 0.5f : 0.0f);
-            float gridY = row;
+    map::hexmap = std::move(frame->grid);
+    map::distToWater = std::move(frame->distToWater);
+    map::statistics = frame->statistics;
+    map::params = frame->params;
+    map::generationReport = std::move(frame->report);
 
-            float c;
-            glm::vec3 color;
-            ObjData hex;
-
-            Tile& tile = map::hexmap[HexCoord{gridX, gridY}];
-            // Déterminer le biome
-            tile.computeClimate(waterTiles);
-            if(tile.biome.biomeType != BiomeType::Water) {
-                tile.define_biome();
-            }
+    map::tileInstances = std::move(frame->instances);
+    map::tileAttributes = std::move(frame->attributes);
+    uploadTileInstances(map::hexmap, map::tileInstances, map::tileAttributes);
 
-            switch (gameParam::tile_color) {
-                case 0:   // Biome
-                    color = tile.biome.color;
-                    hex = createTileModel(x/conf::model_size_div, y/conf::model_size_div, tile.height, radius/conf::model_size_div, color);
-                    break;
-
-                case 1:   // Hauteur
-                    c = tile.height;
-                    color = glm::vec3(c, c, c);
-                    hex = createTileModel(x/conf::model_size_div, y/conf::model_size_div, tile.height*5, radius/conf::model_size_div, color);
-                    break;
-
-                case 2:   // Température
-                    c = ((tile.temperature - gameParam::min_temp) / (gameParam::max_temp - gameParam::min_temp));
-                    color = glm::vec3(c, c, c);
-                    hex = createTileModel(x/conf::model_size_div, y/conf::model_size_div, c*5, radius/conf::model_size_div, color);
-                    break;
-
-                case 3:   // Précipitation
-                    c = (tile.precipitation / gameParam::max_precipitation);
-                    color = glm::vec3(c, c, c);
-                    hex = createTileModel(x/conf::model_size_div, y/conf::model_size_div, c*5, radius/conf::model_size_div, color);
-                    break;
-            }
+    // Centrer la caméra
+    const TileLayout layout = TileLayout::forMapSize(frame->params.map_size);
+    float centerX = (frame->params.map_size * layout.w) / 2.0f / conf::model_size_div;
+    float centerZ = ((frame->params.map_size - 1) * (layout.h * 0.75f)) / 2.0f / conf::model_size_div;
+    gameUtils::cam.target = glm::vec3(centerX, 0.0f, centerZ);
 
-            initObject(hex);
-            map::hexmap_drawable.push_back(hex);
-        }
-    }
+    return true;
 }
 
-void createRivers(Tile& tile) {
-    Tile* lowest = lowestNeighbor(tile);
-    if (!lowest) return;
-
-    if (lowest->height >= tile.height)
-        return; // pas plus bas → fin du fleuve
-
-    lowest->setBiomeAquatic(); // devient rivière
-
-    createRivers(*lowest);
+bool isGeneratingHexmap() {
+    return worker.busy;
 }
 
-Tile* lowestNeighbor(Tile& tile) {
-    Tile* lowest = nullptr;
-
-    for (Tile* n : tile.getAllNeighbors()) {
-        if (!lowest || n->height < lowest->height) {
-            lowest = n;
-        }
+void stopHexmapGeneration() {
+    {
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        worker.stopping = true;
     }
+    worker.wakeUp.notify_one();
 
-    if(lowest->biome.biomeType == BiomeType::Water) return nullptr;
-
-    return lowest;
+    if (worker.thread.joinable()) {
+        worker.thread.join();
+    }
 }
\ No newline at end of file
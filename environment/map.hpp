@@ -1,17 +1,37 @@
 #pragma once
 
 #include <vector>
-#include <unordered_map>
-#include <unordered_set>
 
 #include "HexCoord.hpp"
+#include "HexGrid.hpp"
 #include "Tile.hpp"
-#include "../rendering/graphicUtils.hpp"
-#include "../object/tileModel.hpp"
+#include "MapGenerator.hpp"
+#include "TileRenderData.hpp"
 
+// carte affichée : uniquement lue et modifiée par le thread de rendu
 namespace map {
-    inline std::unordered_map<HexCoord, Tile> hexmap;
-    inline std::vector<ObjData> hexmap_drawable;
+    inline HexGrid hexmap;
+    // distance (en tiles) à l'eau la plus proche, indexée comme hexmap
+    inline std::vector<int> distToWater;
+    // statistiques de la carte affichée, calculées pendant la génération
+    inline MapStatistics statistics;
+    // paramètres avec lesquels la carte affichée a été générée (pas forcément ceux de gameParam)
+    inline MapParams params;
+    // une instance du modèle de tile par tile, indexée comme hexmap
+    inline std::vector<TileInstance> tileInstances;
+    // valeurs de chaque tile envoyées au shader, indexées comme hexmap
+    inline std::vector<TileAttributes> tileAttributes;
+
+    // étapes de la génération affichée : recalculée ou reprise du cache, et durée
+    inline std::vector<StageReport> generationReport;
 }
 
+// demande une génération avec les paramètres actuels, calculée sur un thread à part
+// une demande plus récente annule celle en cours
 void createHexmap();
+// à appeler à chaque frame depuis le thread de rendu : installe la dernière carte terminée
+// et l'envoie à OpenGL, retourne true si la carte a changé
+bool updateHexmap();
+bool isGeneratingHexmap();
+// arrête le thread de génération (avant de détruire le contexte OpenGL)
+void stopHexmapGeneration();
\ No newline at end of file
@@ -0,0 +1,80 @@
+#include "mapData.hpp"
+#include "../gameParam.hpp"
+
+#include <cmath>
+#include <fstream>
+#include <iostream>
+
+static double roundToTwo(float value);
+
+bool writeMapData(const std::string& path, const MapParams& params, const MapStatistics& statistics) {
+    std::ofstream file(path);
+
+    if (!file) {
+        std::cerr << "Erreur : impossible d'ouvrir le fichier !" << std::endl;
+        return false;
+    }
+
+    file << "grid_size = " << params.map_size << "\n"
+         << "map_seed = " << params.map_seed << "\n"
+         << "map_octaves = " << params.map_octaves << "\n"
+         << "map_persistence = " << params.map_persistence << "\n"
+         << "map_lacunarity = " << params.map_lacunarity << "\n"
+         << "map_frequency = " << params.map_frequency << "\n\n";
+
+    file << "water_threshold = " << params.water_threshold << "\n\n";
+
+    // bornes d'affichage : ne changent pas la carte, lues dans gameParam
+    file << "min_temp = " << gameParam::min_temp << "\n"
+         << "max_temp = " << gameParam::max_temp << "\n"
+         << "max_precipitation = " << gameParam::max_precipitation << "\n\n";
+
+    for (int type = 0; type < statistics.biomes.size(); ++type) {
+        if (statistics.biomes[type] > 0) {
+            file << getBiome(static_cast<BiomeType>(type)).name << " : " << statistics.biomes[type] << "\n";
+        }
+    }
+
+    const std::pair<const char*, const ValueStatistics*> values[] = {
+        {"Hauteur", &statistics.height},
+        {"Température", &statistics.temperature},
+        {"Précipitation", &statistics.precipitation},
+    };
+    for (const auto& [name, value] : values) {
+        file << "\n" << name << " :\n";
+        file << "\t- minimum = " << roundToTwo(value->stats.min()) << "\n";
+        file << "\t- maximum = " << roundToTwo(value->stats.max()) << "\n";
+        file << "\t- moyenne = " << roundToTwo(value->stats.mean()) << "\n";
+        file << "\t- medianne = " << roundToTwo(value->quantiles.quantile(0.5f)) << "\n";
+    }
+
+    file.close();
+    return true;
+}
+
+static double roundToTwo(float value) {
+    double factor = std::pow(10.0, 2);
+    return std::round(value * factor) / factor;
+}
+
+bool writeTilesCsv(const std::string& path, const HexGrid& grid, const std::vector<int>& distToWater) {
+    std::ofstream file(path);
+
+    if (!file) {
+        std::cerr << "Erreur : impossible d'ouvrir le fichier !" << std::endl;
+        return false;
+    }
+
+    file << "index,row,col,height,temperature,precipitation,isWater,flow,biome,distToWater\n";
+    for (const Tile& tile : grid) {
+        int row = static_cast<int>(tile.hexCoord.y);
+        int col = static_cast<int>(std::floor(tile.hexCoord.x));
+        file << tile.index << "," << row << "," << col << ","
+             << tile.height << "," << tile.temperature << "," << tile.precipitation << ","
+             << tile.isWater << "," << tile.flow << ","
+             << static_cast<int>(tile.biome.biomeType) << ","
+             << distToWater[tile.index] << "\n";
+    }
+
+    return static_cast<bool>(file);
+}
\ No newline at end of file
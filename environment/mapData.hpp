@@ -0,0 +1,16 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "HexGrid.hpp"
+#include "MapParams.hpp"
+#include "MapStatistics.hpp"
+
+// résumé de la carte : paramètres de génération (ceux de la carte, pas gameParam qui a pu
+// changer depuis), bornes d'affichage, nombre de tiles par biome, statistiques de
+// hauteur / température / précipitation ; false si le fichier ne peut pas être écrit
+bool writeMapData(const std::string& path, const MapParams& params, const MapStatistics& statistics);
+
+// une ligne par tile (ordre de la grille) avec toutes ses valeurs
+bool writeTilesCsv(const std::string& path, const HexGrid& grid, const std::vector<int>& distToWater);
\ No newline at end of file
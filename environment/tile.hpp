@@ -6,21 +6,21 @@
 class Tile {
 public :
     HexCoord hexCoord;
+    int index = -1; // position dans la HexGrid
     float height;
     float temperature;
     float precipitation;
-    bool isWater = false;
+    bool isWater = false; // vrai si le biome est Water (posé par setBiomeAquatic)
     float flow = 0.0f;
     Biome biome;
 
     void setBiomeAquatic();
-    void define_biome(int nbAquaticNeighbors);
-
-    Tile* getNeighbors(hexNeighbors neighbors);
-    std::vector<Tile*> getAllNeighbors();
+    void define_biome();
+    // noiseValue : bruit fractal de la tile dans [0, 1], calculé pour toute la carte en amont
+    // distToWater : distance en tiles à l'eau la plus proche (distanceField)
+    void computeClimate(float noiseValue, int distToWater, int mapSize);
 
 private :
-    float compute_temperature(int nbAquaticNeighbors);
-    float compute_precipitation(int nbAquaticNeighbors);
-    float getLatitude();
+    float getDistToOcean(int distToWater);
+    float local_evap(float temp);
 };
\ No newline at end of file
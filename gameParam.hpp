@@ -25,6 +25,30 @@ namespace gameParam
     inline float max_temp = 30.0f;
     inline float max_precipitation = 325.0f;
 
+    /* Ressources */
+    inline float plant_growth = 0.05f;     // vitesse de pousse des plantes (logistique)
+    inline float meat_decay = 0.02f;       // part de viande décomposée par tick à 0°C sans pluie
+    inline float water_refill = 0.1f;      // part de la réserve d'eau rendue par tick
+    inline float water_scale = 100.0f;     // réserve d'eau d'une tile voisine de l'eau
+
+    /* Créatures */
+    inline float hunger_rate = 0.010f;     // faim gagnée par tick pour une créature de référence
+    inline float thirst_rate = 0.015f;
+    inline float love_rate = 0.005f;
+    inline float perception_cost = 0.2f;   // part de faim / soif en plus par point de perception
+    inline int maturity_age = 50;          // ticks avant de pouvoir se reproduire
+    inline float mutation_chance = 1.0f / 3.0f;
+    inline float mutation_amount = 0.3f;   // variation maximale d'une caractéristique mutée
+    inline float scent_lifetime = 8.0f;    // ticks avant qu'une trace d'odeur disparaisse
+
+    /* Simulation */
+    inline int nb_creatures = 10000;       // population de départ
+    inline int nb_ticks = 0;               // ticks simulés par la version sans affichage
+    inline int snapshot_every = 0;         // ticks entre deux snapshots de la version sans affichage, 0 = aucun
+
+    /* Performance */
+    inline int nb_threads = 0; // threads de génération, 0 = un par coeur
+
     /* Debugging */
     inline int tile_color = 0;
     inline bool showWaterLevel = false;
@@ -0,0 +1,352 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "gameParam.hpp"
+#include "paramConfig.hpp"
+#include "creatures/Simulation.hpp"
+#include "creatures/Snapshot.hpp"
+#include "environment/MapGenerator.hpp"
+#include "environment/mapData.hpp"
+#include "utils/AllocationCounter.hpp"
+#include "utils/ThreadPool.hpp"
+
+/**
+ * Version sans affichage : génère la carte sur le CPU uniquement (ni GLFW, ni GLAD, ni ImGui)
+ * et écrit les résultats sur le disque.
+ *
+ * headless [--config fichier] [--out dossier] [--sweep] [--resume snapshot] [cle=valeur ...]
+ *   --config : fichier "cle = valeur" (mêmes clés que gameParam, map_data.txt est accepté)
+ *   --out    : dossier de sortie (défaut : headless_output)
+ *   cle=valeur : appliqué après le fichier de configuration, dans l'ordre
+ *   avec nb_ticks > 0, nb_creatures créatures sont ensuite simulées sur la carte
+ *   (simulation.csv : population, empreinte de l'état et allocations sur le tas à chaque tick)
+ *   avec snapshot_every > 0, l'état est sauvegardé tous les snapshot_every ticks dans
+ *   simulation.snap (écrit en arrière-plan pendant les ticks suivants)
+ *
+ *   --resume : reprend la simulation d'un snapshot pour nb_ticks ticks de plus, sans
+ *     générer de carte ; les cle=valeur de la ligne de commande remplacent celles du snapshot
+ *
+ *   --sweep : balayage de paramètres, chaque cle=valeurs devient un axe de la grille :
+ *     cle=a,b,c        liste de valeurs
+ *     cle=debut:fin    entiers de debut à fin inclus
+ *     cle=debut:fin:pas
+ *   Toutes les combinaisons sont générées en parallèle (une carte par thread à la fois),
+ *   une ligne par carte dans sweep.csv.
+ */
+
+struct SweepAxis {
+    std::string key;
+    std::vector<std::string> values;
+};
+
+// ligne de sweep.csv : les statistiques complètes d'une carte ne sont pas gardées
+struct WorldRow {
+    int biomes[static_cast<int>(BiomeType::None) + 1];
+    float values[3][4]; // hauteur, température, précipitation : min, max, moyenne, médiane
+
+    WorldRow() = default;
+    explicit WorldRow(const MapStatistics& statistics) {
+        for (int type = 0; type < statistics.biomes.size(); ++type) biomes[type] = statistics.biomes[type];
+
+        const ValueStatistics* stats[] = {&statistics.height, &statistics.temperature, &statistics.precipitation};
+        for (int v = 0; v < 3; ++v) {
+            values[v][0] = stats[v]->stats.min();
+            values[v][1] = stats[v]->stats.max();
+            values[v][2] = stats[v]->stats.mean();
+            values[v][3] = stats[v]->quantiles.quantile(0.5f);
+        }
+    }
+};
+
+static void printUsage() {
+    std::printf("usage : headless [--config fichier] [--out dossier] [--sweep] [--resume snapshot] [cle=valeur ...]\n");
+}
+
+// "a,b,c", "debut:fin" ou "debut:fin:pas" -> liste des valeurs (texte)
+static bool expandValues(const std::string& text, std::vector<std::string>& values) {
+    if (text.find(',') != std::string::npos) {
+        size_t start = 0;
+        while (start <= text.size()) {
+            size_t comma = text.find(',', start);
+            if (comma == std::string::npos) comma = text.size();
+            values.push_back(text.substr(start, comma - start));
+            start = comma + 1;
+        }
+        return true;
+    }
+
+    size_t colon = text.find(':');
+    if (colon == std::string::npos) {
+        values.push_back(text);
+        return true;
+    }
+
+    size_t colon2 = text.find(':', colon + 1);
+    std::string first = text.substr(0, colon);
+    std::string last = text.substr(colon + 1, colon2 == std::string::npos ? std::string::npos : colon2 - colon - 1);
+    std::string step = (colon2 == std::string::npos) ? "1" : text.substr(colon2 + 1);
+
+    char* end = nullptr;
+    double a = std::strtod(first.c_str(), &end);
+    if (end == first.c_str() || *end != '\0') return false;
+    double b = std::strtod(last.c_str(), &end);
+    if (end == last.c_str() || *end != '\0') return false;
+    double s = std::strtod(step.c_str(), &end);
+    if (end == step.c_str() || *end != '\0' || s <= 0.0) return false;
+
+    const bool integers = (text.find('.') == std::string::npos);
+    // a + k * pas plutôt qu'une somme : pas d'erreur d'arrondi cumulée
+    for (long k = 0; a + k * s <= b + s * 1e-6; ++k) {
+        double value = a + k * s;
+        values.push_back(integers ? std::to_string(static_cast<long long>(value)) : std::to_string(value));
+    }
+    return !values.empty();
+}
+
+static int runSimulation(const std::filesystem::path& out, Simulation& simulation) {
+    std::ofstream file(out / "simulation.csv");
+    if (!file) {
+        std::cerr << "Erreur : impossible d'ouvrir le fichier !" << std::endl;
+        return 1;
+    }
+
+    SnapshotWriter snapshots;
+    const std::string snapshotPath = (out / "simulation.snap").string();
+    int nbSnapshots = 0;
+    int nbSkipped = 0;
+    double copySeconds = 0.0;
+
+    file << "tick,population,hash,allocations\n";
+    double seconds = 0.0;
+    uint64_t totalAllocations = 0;
+    uint32_t lastAllocatingTick = 0;
+    for (int t = 0; t < gameParam::nb_ticks; ++t) {
+        // seul le tick est compté (l'écriture du fichier alloue aussi)
+        uint64_t allocationsBefore = allocationCounter::count();
+        auto start = std::chrono::high_resolution_clock::now();
+        simulation.tick();
+        auto end = std::chrono::high_resolution_clock::now();
+        uint64_t allocations = allocationCounter::count() - allocationsBefore;
+
+        seconds += std::chrono::duration<double>(end - start).count();
+        totalAllocations += allocations;
+        if (allocations > 0) lastAllocatingTick = simulation.currentTick();
+
+        char hash[17];
+        std::snprintf(hash, sizeof(hash), "%016llx", static_cast<unsigned long long>(simulation.stateHash()));
+        file << simulation.currentTick() << "," << simulation.creatures().count() << "," << hash << "," << allocations << "\n";
+
+        // seule la copie de l'état (sur les threads de la simulation) retient le tick suivant,
+        // l'écriture se fait en parallèle
+        if (gameParam::snapshot_every > 0 && simulation.currentTick() % gameParam::snapshot_every == 0) {
+            auto copyStart = std::chrono::high_resolution_clock::now();
+            bool started = snapshots.save(simulation, snapshotPath);
+            copySeconds += std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - copyStart).count();
+            started ? nbSnapshots++ : nbSkipped++;
+        }
+    }
+    if (!snapshots.wait()) {
+        std::cerr << "Erreur : impossible d'écrire le snapshot " << snapshotPath << std::endl;
+        return 1;
+    }
+
+    std::printf("%d ticks en %.2f s (%.2f ms/tick), population finale %d, empreinte %016llx\n",
+        gameParam::nb_ticks, seconds, 1000.0 * seconds / gameParam::nb_ticks,
+        simulation.creatures().count(), static_cast<unsigned long long>(simulation.stateHash()));
+    // en régime établi les tableaux ont atteint leur capacité : plus aucune allocation
+    std::printf("%llu allocations pendant les ticks, derniere au tick %u\n",
+        static_cast<unsigned long long>(totalAllocations), lastAllocatingTick);
+    if (nbSnapshots + nbSkipped > 0) {
+        std::printf("%d snapshots (copie %.2f ms en moyenne), %d sautes (ecriture precedente en cours)\n",
+            nbSnapshots, nbSnapshots ? 1000.0 * copySeconds / nbSnapshots : 0.0, nbSkipped);
+    }
+    return 0;
+}
+
+static int runResume(const std::filesystem::path& out, const std::string& snapshotPath, const std::vector<SweepAxis>& axes) {
+    // le snapshot remplace gameParam : la ligne de commande reprend la main juste après,
+    // avant que ressources et odeurs ne soient reconstruites
+    std::string overrides;
+    for (const SweepAxis& axis : axes) overrides += axis.key + " = " + axis.values[0] + "\n";
+
+    Simulation simulation(gameParam::nb_threads);
+    auto start = std::chrono::high_resolution_clock::now();
+    if (!loadSnapshot(snapshotPath, simulation, overrides)) {
+        std::cerr << "Erreur : snapshot absent ou invalide (" << snapshotPath << ")" << std::endl;
+        return 1;
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+
+    std::printf("snapshot %s : tick %u, %d creatures, lu en %.2f ms\n",
+        snapshotPath.c_str(), simulation.currentTick(), simulation.creatures().count(), 1000.0 * seconds);
+    if (gameParam::nb_ticks > 0 && runSimulation(out, simulation) != 0) return 1;
+
+    std::printf("donnees ecrites dans %s\n", out.string().c_str());
+    return 0;
+}
+
+static int runSingle(const std::filesystem::path& out) {
+    // pas de rendu : les étapes qui ne préparent que les données d'affichage sont sautées
+    MapGenerator generator(gameParam::nb_threads, false);
+    MapFrame frame;
+    generator.generate(MapParams::current(), frame);
+
+    std::printf("carte %dx%d (%d tiles), seed %d\n", gameParam::map_size, gameParam::map_size, frame.grid.count(), gameParam::map_seed);
+    for (const StageReport& stage : frame.report) {
+        std::printf("  %s : %.2f ms\n", stage.name, stage.durationMs);
+    }
+
+    if (!writeMapData((out / "map_data.txt").string(), frame.params, frame.statistics)) return 1;
+    if (!writeTilesCsv((out / "tiles.csv").string(), frame.grid, frame.distToWater)) return 1;
+    if (gameParam::nb_ticks > 0) {
+        Simulation simulation(gameParam::nb_threads);
+        simulation.reset(frame.grid, frame.distToWater, gameParam::nb_creatures, static_cast<uint32_t>(gameParam::map_seed));
+        if (runSimulation(out, simulation) != 0) return 1;
+    }
+
+    std::printf("donnees ecrites dans %s\n", out.string().c_str());
+    return 0;
+}
+
+static int runSweep(const std::filesystem::path& out, const std::vector<SweepAxis>& axes) {
+    // toutes les combinaisons, le dernier axe varie le plus vite
+    size_t nbWorlds = 1;
+    for (const SweepAxis& axis : axes) nbWorlds *= axis.values.size();
+
+    std::vector<MapParams> worlds(nbWorlds);
+    std::vector<std::vector<std::string>> worldValues(nbWorlds, std::vector<std::string>(axes.size()));
+    for (size_t w = 0; w < nbWorlds; ++w) {
+        size_t rest = w;
+        for (int a = static_cast<int>(axes.size()) - 1; a >= 0; --a) {
+            const std::string& value = axes[a].values[rest % axes[a].values.size()];
+            rest /= axes[a].values.size();
+
+            if (!setGameParam(axes[a].key, value)) {
+                std::cerr << "Erreur : paramètre inconnu ou valeur invalide (" << axes[a].key << "=" << value << ")" << std::endl;
+                return 1;
+            }
+            worldValues[w][a] = value;
+        }
+        worlds[w] = MapParams::current();
+    }
+
+    // une carte par thread à la fois (génération séquentielle dans chaque bloc) :
+    // les cartes voisines d'un bloc ne diffèrent souvent que par le dernier axe,
+    // le générateur du bloc reprend alors les étapes en amont de son cache.
+    // Plusieurs petits blocs par thread (au plus 8 cartes) : les blocs sont distribués au fil
+    // de l'eau, les cartes coûteuses (grand map_size) ne bloquent pas un seul thread
+    ThreadPool pool(gameParam::nb_threads);
+    std::vector<WorldRow> rows(nbWorlds);
+    const int blockSize = std::clamp(static_cast<int>(nbWorlds) / (4 * pool.size()), 1, 8);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    pool.parallelFor(static_cast<int>(nbWorlds), blockSize, [&](int first, int last) {
+        MapGenerator generator(1, false);
+        MapFrame frame;
+        for (int w = first; w < last; ++w) {
+            generator.generate(worlds[w], frame);
+            rows[w] = WorldRow(frame.statistics);
+        }
+    });
+    auto end = std::chrono::high_resolution_clock::now();
+    double seconds = std::chrono::duration<double>(end - start).count();
+
+    std::ofstream file(out / "sweep.csv");
+    if (!file) {
+        std::cerr << "Erreur : impossible d'ouvrir le fichier !" << std::endl;
+        return 1;
+    }
+
+    file << "world";
+    for (const SweepAxis& axis : axes) file << "," << axis.key;
+    for (int type = 0; type <= static_cast<int>(BiomeType::None); ++type) {
+        file << "," << getBiome(static_cast<BiomeType>(type)).name;
+    }
+    for (const char* name : {"height", "temperature", "precipitation"}) {
+        file << "," << name << "_min," << name << "_max," << name << "_mean," << name << "_median";
+    }
+    file << "\n";
+
+    for (size_t w = 0; w < nbWorlds; ++w) {
+        file << w;
+        for (const std::string& value : worldValues[w]) file << "," << value;
+        for (int count : rows[w].biomes) file << "," << count;
+        for (const auto& value : rows[w].values) {
+            file << "," << value[0] << "," << value[1] << "," << value[2] << "," << value[3];
+        }
+        file << "\n";
+    }
+
+    std::printf("%zu cartes en %.2f s (%.1f cartes/s, %d threads)\n", nbWorlds, seconds, nbWorlds / seconds, pool.size());
+    std::printf("donnees ecrites dans %s\n", (out / "sweep.csv").string().c_str());
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    std::string outDir = "headless_output";
+    bool sweep = false;
+    std::string resumePath;
+    std::vector<SweepAxis> axes;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+
+        if (arg == "--help" || arg == "-h") {
+            printUsage();
+            return 0;
+        }
+        else if (arg == "--config" && i + 1 < argc) {
+            if (!loadGameParamFile(argv[++i])) return 1;
+        }
+        else if (arg == "--out" && i + 1 < argc) {
+            outDir = argv[++i];
+        }
+        else if (arg == "--sweep") {
+            sweep = true;
+        }
+        else if (arg == "--resume" && i + 1 < argc) {
+            resumePath = argv[++i];
+        }
+        else if (arg.find('=') != std::string::npos) {
+            size_t equal = arg.find('=');
+            SweepAxis axis{arg.substr(0, equal), {}};
+            if (!expandValues(arg.substr(equal + 1), axis.values) || !setGameParam(axis.key, axis.values[0])) {
+                std::cerr << "Erreur : paramètre inconnu ou valeur invalide (" << arg << ")" << std::endl;
+                return 1;
+            }
+            axes.push_back(axis);
+        }
+        else {
+            std::cerr << "Erreur : argument inconnu (" << arg << ")" << std::endl;
+            printUsage();
+            return 1;
+        }
+    }
+
+    for (const SweepAxis& axis : axes) {
+        if (axis.values.size() > 1 && !sweep) {
+            std::cerr << "Erreur : plusieurs valeurs pour " << axis.key << " sans --sweep" << std::endl;
+            return 1;
+        }
+    }
+
+    std::error_code error;
+    std::filesystem::create_directories(outDir, error);
+    if (error) {
+        std::cerr << "Erreur : impossible de créer le dossier " << outDir << std::endl;
+        return 1;
+    }
+
+    if (sweep && !resumePath.empty()) {
+        std::cerr << "Erreur : --sweep et --resume ne vont pas ensemble" << std::endl;
+        return 1;
+    }
+    if (!resumePath.empty()) return runResume(outDir, resumePath, axes);
+    return sweep ? runSweep(outDir, axes) : runSingle(outDir);
+}
\ No newline at end of file
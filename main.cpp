@@ -17,6 +17,8 @@
 #include "environment/map.hpp"
 #include "rendering/graphicUtils.hpp"
 #include "rendering/guiParameter.hpp"
+#include "rendering/tileRenderer.hpp"
+#include "object/tileModel.hpp"
 
 // Fonction callback pour redimensionner la fenêtre
 void framebuffer_size_callback(GLFWwindow* window, int width, int height) {
@@ -69,6 +71,11 @@ int main() {
     initializeMouse(window);
 
     loadResources();
+    initTileRenderer(shaderProgram, tileModelOriginal, tileModelLow);
+
+    // plans de la hauteur de l'eau et de la hauteur max : créés une fois, placés avec la matrice model
+    ObjData waterLevelSquare = createSquare(glm::vec3(0, 0, 220));
+    ObjData maxHeightSquare = createSquare(glm::vec3(150, 150, 150));
 
     // Init ImGui
     IMGUI_CHECKVERSION();
@@ -91,6 +98,9 @@ int main() {
         ImGui::NewFrame();
         createParameter();
 
+        // installer la dernière carte générée en arrière-plan
+        updateHexmap();
+
         // Couleur de fond
         glClearColor(0.1f, 0.1f, 0.1f, 1.0f);
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
@@ -106,21 +116,18 @@ int main() {
         glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "view"), 1, GL_FALSE, glm::value_ptr(view));
         glUniformMatrix4fv(glGetUniformLocation(shaderProgram, "projection"), 1, GL_FALSE, glm::value_ptr(projection));
         
-        for (ObjData& tile : map::hexmap_drawable) {
-            drawObject(tile);
-        }
+        // chunks visibles seulement (niveau de détail selon la caméra), couleur et hauteur selon tile_color
+        drawTiles(shaderProgram, gameUtils::cam, projection * view);
 
         if(gameParam::showWaterLevel) {
             float height = gameParam::water_threshold;
             if(gameParam::tile_color != 0) height *= 5;
-            ObjData waterLevelSquare = createSquare(height + (1.0f / conf::model_size_div), glm::vec3(0, 0, 220));
-            drawObject(waterLevelSquare);
+            drawPlane(shaderProgram, waterLevelSquare, height + (1.0f / conf::model_size_div));
         }
         if(gameParam::showMaxHeight) {
             float height = 1.0f;
             if(gameParam::tile_color != 0) height *= 5;
-            ObjData maxHeightSquare = createSquare(height + (1.0f / conf::model_size_div), glm::vec3(150, 150, 150));
-            drawObject(maxHeightSquare);
+            drawPlane(shaderProgram, maxHeightSquare, height + (1.0f / conf::model_size_div));
         }
 
         // Rendu de l’UI ImGui
@@ -130,6 +137,9 @@ int main() {
         glfwSwapBuffers(window);
     }
 
+    stopHexmapGeneration();
+    gpuMemory::shutdown();
+
     ImGui_ImplOpenGL3_Shutdown();
     ImGui_ImplGlfw_Shutdown();
     ImGui::DestroyContext();
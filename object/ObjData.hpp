@@ -1,7 +1,10 @@
 #pragma once
 
+#include <vector>
 #include <glm/glm.hpp>
 
+#include "../rendering/GpuBuffer.hpp"
+
 struct Vertex {
     glm::vec3 position;
     glm::vec3 normal;
@@ -9,10 +12,11 @@ struct Vertex {
     glm::vec3 color;
 };
 
+// maillage côté CPU + ses buffers OpenGL (libérés avec l'objet, qui ne peut donc qu'être déplacé)
 struct ObjData {
-    unsigned int VAO = 0;
-    unsigned int VBO = 0;
-    unsigned int EBO = 0;
+    VertexArray VAO;
+    GpuBuffer VBO;
+    GpuBuffer EBO;
     std::vector<unsigned int> indices;
     std::vector<Vertex> vertices;
 };
\ No newline at end of file
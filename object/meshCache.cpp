@@ -0,0 +1,248 @@
+#include "meshCache.hpp"
+#include "tileModel.hpp"
+#include "../utils/MappedFile.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <unordered_map>
+
+namespace {
+    constexpr char MAGIC[4] = {'H', 'X', 'M', 'S'};
+    constexpr uint32_t VERSION = 1;
+
+    struct MeshCacheHeader {
+        char magic[4];
+        uint32_t version;
+        uint64_t sourceSize;
+        int64_t sourceTime;
+        uint32_t vertexSize;   // sizeof(Vertex) à l'écriture
+        uint32_t vertexCount;
+        uint32_t indexCount;
+        uint32_t padding;
+    };
+
+    // nombre de sommets gardés dans le cache simulé par optimizeMesh
+    constexpr int CACHE_SIZE = 16;
+
+    // clé de déduplication : position, normale et coordonnées de texture, bit à bit
+    struct VertexKey {
+        float values[8];
+
+        bool operator==(const VertexKey& other) const {
+            return std::memcmp(values, other.values, sizeof(values)) == 0;
+        }
+    };
+
+    struct VertexKeyHash {
+        size_t operator()(const VertexKey& key) const {
+            uint64_t h = 1469598103934665603ull;
+            const unsigned char* bytes = reinterpret_cast<const unsigned char*>(key.values);
+            for (size_t i = 0; i < sizeof(key.values); ++i) {
+                h = (h ^ bytes[i]) * 1099511628211ull;
+            }
+            return static_cast<size_t>(h);
+        }
+    };
+
+    VertexKey keyOf(const Vertex& v) {
+        return VertexKey{{v.position.x, v.position.y, v.position.z,
+                          v.normal.x, v.normal.y, v.normal.z,
+                          v.texCoords.x, v.texCoords.y}};
+    }
+}
+
+/* ----- optimisation ----- */
+
+static void deduplicateVertices(ObjData& mesh) {
+    std::unordered_map<VertexKey, unsigned int, VertexKeyHash> unique;
+    std::vector<Vertex> vertices;
+    std::vector<unsigned int> remap(mesh.vertices.size());
+
+    for (size_t i = 0; i < mesh.vertices.size(); ++i) {
+        auto [it, inserted] = unique.try_emplace(keyOf(mesh.vertices[i]), static_cast<unsigned int>(vertices.size()));
+        if (inserted) vertices.push_back(mesh.vertices[i]);
+        remap[i] = it->second;
+    }
+
+    for (unsigned int& index : mesh.indices) {
+        index = remap[index];
+    }
+    mesh.vertices = std::move(vertices);
+}
+
+// ordre des triangles : on prend toujours le triangle qui réutilise le plus de sommets
+// du cache (FIFO), les sommets récents restent ainsi dans le cache post-transformation
+static void reorderTriangles(ObjData& mesh) {
+    const int nbTriangles = static_cast<int>(mesh.indices.size() / 3);
+
+    std::vector<std::vector<int>> trianglesOfVertex(mesh.vertices.size());
+    for (int t = 0; t < nbTriangles; ++t) {
+        for (int k = 0; k < 3; ++k) {
+            trianglesOfVertex[mesh.indices[3 * t + k]].push_back(t);
+        }
+    }
+
+    std::vector<bool> emitted(nbTriangles, false);
+    std::vector<unsigned int> cache;
+    std::vector<unsigned int> indices;
+    indices.reserve(mesh.indices.size());
+
+    auto inCache = [&](unsigned int v) {
+        return std::find(cache.begin(), cache.end(), v) != cache.end();
+    };
+
+    int nextUnemitted = 0;
+    for (int done = 0; done < nbTriangles; ++done) {
+        // meilleur triangle voisin des sommets du cache
+        int best = -1;
+        int bestScore = 0;
+        for (unsigned int v : cache) {
+            for (int t : trianglesOfVertex[v]) {
+                if (emitted[t]) continue;
+                int score = 0;
+                for (int k = 0; k < 3; ++k) score += inCache(mesh.indices[3 * t + k]);
+                if (score > bestScore) {
+                    best = t;
+                    bestScore = score;
+                }
+            }
+        }
+        if (best < 0) {
+            while (emitted[nextUnemitted]) nextUnemitted++;
+            best = nextUnemitted;
+        }
+
+        emitted[best] = true;
+        for (int k = 0; k < 3; ++k) {
+            unsigned int v = mesh.indices[3 * best + k];
+            indices.push_back(v);
+            if (!inCache(v)) {
+                cache.push_back(v);
+                if (static_cast<int>(cache.size()) > CACHE_SIZE) cache.erase(cache.begin());
+            }
+        }
+    }
+
+    mesh.indices = std::move(indices);
+}
+
+// sommets renumérotés dans l'ordre de leur première utilisation (lectures mémoire linéaires)
+static void reorderVertices(ObjData& mesh) {
+    const unsigned int unused = static_cast<unsigned int>(-1);
+    std::vector<unsigned int> remap(mesh.vertices.size(), unused);
+    std::vector<Vertex> vertices;
+    vertices.reserve(mesh.vertices.size());
+
+    for (unsigned int& index : mesh.indices) {
+        if (remap[index] == unused) {
+            remap[index] = static_cast<unsigned int>(vertices.size());
+            vertices.push_back(mesh.vertices[index]);
+        }
+        index = remap[index];
+    }
+
+    mesh.vertices = std::move(vertices);
+}
+
+void optimizeMesh(ObjData& mesh) {
+    deduplicateVertices(mesh);
+    reorderTriangles(mesh);
+    reorderVertices(mesh);
+}
+
+/* ----- fichier cache ----- */
+
+std::string meshCachePath(const std::string& objPath) {
+    std::filesystem::path path(objPath);
+    path.replace_extension(".mesh");
+    return path.string();
+}
+
+bool readMeshCache(const std::string& cachePath, unsigned long long sourceSize, long long sourceTime, ObjData& mesh) {
+    MappedFile file;
+    if (!file.open(cachePath)) return false;
+    if (file.size() < sizeof(MeshCacheHeader)) return false;
+
+    MeshCacheHeader header;
+    std::memcpy(&header, file.data(), sizeof(header));
+
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.version != VERSION
+        || header.vertexSize != sizeof(Vertex)
+        || header.sourceSize != sourceSize || header.sourceTime != sourceTime) {
+        return false;
+    }
+
+    const size_t vertexBytes = static_cast<size_t>(header.vertexCount) * sizeof(Vertex);
+    const size_t indexBytes = static_cast<size_t>(header.indexCount) * sizeof(uint32_t);
+    if (file.size() != sizeof(header) + vertexBytes + indexBytes) return false;
+
+    const unsigned char* data = file.data() + sizeof(header);
+    mesh.vertices.resize(header.vertexCount);
+    std::memcpy(mesh.vertices.data(), data, vertexBytes);
+    mesh.indices.resize(header.indexCount);
+    std::memcpy(mesh.indices.data(), data + vertexBytes, indexBytes);
+
+    for (unsigned int index : mesh.indices) {
+        if (index >= header.vertexCount) return false;
+    }
+    return true;
+}
+
+bool writeMeshCache(const std::string& cachePath, unsigned long long sourceSize, long long sourceTime, const ObjData& mesh) {
+    MeshCacheHeader header{};
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.sourceSize = sourceSize;
+    header.sourceTime = sourceTime;
+    header.vertexSize = sizeof(Vertex);
+    header.vertexCount = static_cast<uint32_t>(mesh.vertices.size());
+    header.indexCount = static_cast<uint32_t>(mesh.indices.size());
+
+    // écrit dans un fichier temporaire puis renommé : un cache n'est jamais à moitié écrit
+    const std::string tmpPath = cachePath + ".tmp";
+    {
+        std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) return false;
+
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(mesh.vertices.data()), mesh.vertices.size() * sizeof(Vertex));
+        file.write(reinterpret_cast<const char*>(mesh.indices.data()), mesh.indices.size() * sizeof(unsigned int));
+        if (!file) return false;
+    }
+
+    std::error_code error;
+    std::filesystem::rename(tmpPath, cachePath, error);
+    return !error;
+}
+
+/* ----- chargement ----- */
+
+ObjData loadMesh(const std::string& objPath) {
+    std::error_code error;
+    const unsigned long long sourceSize = std::filesystem::file_size(objPath, error);
+    if (error) {
+        std::printf("Impossible d'ouvrir le fichier : %s\n", objPath.c_str());
+        return ObjData();
+    }
+    const long long sourceTime = std::filesystem::last_write_time(objPath, error).time_since_epoch().count();
+
+    const std::string cachePath = meshCachePath(objPath);
+
+    ObjData mesh;
+    if (readMeshCache(cachePath, sourceSize, sourceTime, mesh)) {
+        return mesh;
+    }
+
+    // cache absent ou périmé : on repasse par le .obj
+    mesh = loadOBJ(objPath);
+    optimizeMesh(mesh);
+
+    if (!writeMeshCache(cachePath, sourceSize, sourceTime, mesh)) {
+        std::printf("Impossible d'écrire le cache : %s\n", cachePath.c_str());
+    }
+    return mesh;
+}
\ No newline at end of file
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <string>
+
+#include "ObjData.hpp"
+
+/**
+ * Cache binaire des modèles .obj : à côté de chaque .obj un fichier .mesh contient les
+ * sommets dédupliqués et les indices réordonnés, il est lu par projection en mémoire
+ * au lieu de parser le texte.
+ *
+ * Format (little endian) :
+ *   en-tête MeshCacheHeader
+ *   vertexCount * Vertex
+ *   indexCount * uint32
+ * Le cache est refait (depuis le .obj) si la taille ou la date de modification
+ * du .obj ne correspondent plus à l'en-tête, ou si la version du format a changé.
+ */
+ObjData loadMesh(const std::string& objPath);
+
+// fusionne les sommets identiques et réordonne triangles et sommets pour le cache GPU
+void optimizeMesh(ObjData& mesh);
+
+std::string meshCachePath(const std::string& objPath);
+bool readMeshCache(const std::string& cachePath, unsigned long long sourceSize, long long sourceTime, ObjData& mesh);
+bool writeMeshCache(const std::string& cachePath, unsigned long long sourceSize, long long sourceTime, const ObjData& mesh);
\ No newline at end of file
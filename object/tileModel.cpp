@@ -1,28 +1,4 @@
 #include "tileModel.hpp"
-#include <glm/ext/matrix_transform.hpp>
-#include "../gameParam.hpp"
-
-ObjData createTileModel(float x, float y, float h, float r, glm::vec3 color) {
-    // Copie du modèle de base
-    ObjData tile = tileModelOriginal;
-
-    // Mise à jour de la couleur sur chaque vertex
-    for(auto& v : tile.vertices) {
-        v.position *= r;
-        v.position += glm::vec3(x, h, y);
-        v.color = color;
-
-        if(v.position.y < h) {
-            if(gameParam::tile_color == 0) {
-                v.position.y = 0.0f;
-            } else {
-                v.position = glm::vec3(x, h, y);
-            }
-        }
-    }
-
-    return tile;
-}
 
 ObjData loadOBJ(const std::string& path) {
     ObjData objData;
@@ -70,6 +46,7 @@ ObjData loadOBJ(const std::string& path) {
                 vertex.position = temp_positions[vIdx - 1];
                 vertex.texCoords = (tIdx > 0) ? temp_uvs[tIdx - 1] : glm::vec2(0.0f);
                 vertex.normal = (nIdx > 0) ? temp_normals[nIdx - 1] : glm::vec3(0.0f, 0.0f, 1.0f);
+                vertex.color = glm::vec3(0.0f);
                 objData.vertices.push_back(vertex);
 
                 faceIndices.push_back(objData.vertices.size() - 1);
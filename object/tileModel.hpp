@@ -8,13 +8,15 @@
 #include <glm/glm.hpp>
 
 #include "ObjData.hpp"
+#include "meshCache.hpp"
 
 inline ObjData tileModelOriginal;
+inline ObjData tileModelLow;
 
+// parser texte du .obj (un sommet par coin de face), utilisé quand le cache .mesh est périmé
 extern ObjData loadOBJ(const std::string& path);
 
 inline void loadResources() {
-    tileModelOriginal = loadOBJ("object/tile_high.obj");
-}
-
-ObjData createTileModel(float x, float y, float h, float r, glm::vec3 color);
\ No newline at end of file
+    tileModelOriginal = loadMesh("object/tile_high.obj");
+    tileModelLow = loadMesh("object/tile_low.obj");
+}
\ No newline at end of file
@@ -0,0 +1,196 @@
+#include "paramConfig.hpp"
+#include "gameParam.hpp"
+
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <variant>
+
+namespace {
+    struct ParamEntry {
+        const char* name;
+        std::variant<int*, float*, bool*> value;
+    };
+
+    const ParamEntry params[] = {
+        {"map_size", &gameParam::map_size},
+        {"grid_size", &gameParam::map_size}, // nom utilisé par map_data.txt
+        {"map_seed", &gameParam::map_seed},
+        {"map_octaves", &gameParam::map_octaves},
+        {"map_persistence", &gameParam::map_persistence},
+        {"map_lacunarity", &gameParam::map_lacunarity},
+        {"map_frequency", &gameParam::map_frequency},
+        {"offsetX", &gameParam::offsetX},
+        {"offsetY", &gameParam::offsetY},
+
+        {"water_threshold", &gameParam::water_threshold},
+        {"flow_threshold", &gameParam::flow_threshold},
+        {"flow_mult", &gameParam::flow_mult},
+        {"nbVN", &gameParam::nbVN},
+
+        {"min_temp", &gameParam::min_temp},
+        {"max_temp", &gameParam::max_temp},
+        {"max_precipitation", &gameParam::max_precipitation},
+
+        {"plant_growth", &gameParam::plant_growth},
+        {"meat_decay", &gameParam::meat_decay},
+        {"water_refill", &gameParam::water_refill},
+        {"water_scale", &gameParam::water_scale},
+
+        {"hunger_rate", &gameParam::hunger_rate},
+        {"thirst_rate", &gameParam::thirst_rate},
+        {"love_rate", &gameParam::love_rate},
+        {"perception_cost", &gameParam::perception_cost},
+        {"maturity_age", &gameParam::maturity_age},
+        {"mutation_chance", &gameParam::mutation_chance},
+        {"mutation_amount", &gameParam::mutation_amount},
+        {"scent_lifetime", &gameParam::scent_lifetime},
+
+        {"nb_creatures", &gameParam::nb_creatures},
+        {"nb_ticks", &gameParam::nb_ticks},
+        {"snapshot_every", &gameParam::snapshot_every},
+
+        {"nb_threads", &gameParam::nb_threads},
+
+        {"tile_color", &gameParam::tile_color},
+        {"showWaterLevel", &gameParam::showWaterLevel},
+        {"showMaxHeight", &gameParam::showMaxHeight},
+    };
+
+    std::string trim(const std::string& s) {
+        size_t first = s.find_first_not_of(" \t\r\n");
+        if (first == std::string::npos) return "";
+        size_t last = s.find_last_not_of(" \t\r\n");
+        return s.substr(first, last - first + 1);
+    }
+
+    bool isIdentifier(const std::string& s) {
+        if (s.empty()) return false;
+        for (char c : s) {
+            if (!std::isalnum(static_cast<unsigned char>(c)) && c != '_') return false;
+        }
+        return true;
+    }
+
+    bool parseInt(const std::string& text, int& out) {
+        char* end = nullptr;
+        long value = std::strtol(text.c_str(), &end, 10);
+        if (end == text.c_str() || *end != '\0') return false;
+        out = static_cast<int>(value);
+        return true;
+    }
+
+    bool parseFloat(const std::string& text, float& out) {
+        char* end = nullptr;
+        float value = std::strtof(text.c_str(), &end);
+        if (end == text.c_str() || *end != '\0') return false;
+        out = value;
+        return true;
+    }
+
+    bool parseBool(const std::string& text, bool& out) {
+        if (text == "1" || text == "true") { out = true; return true; }
+        if (text == "0" || text == "false") { out = false; return true; }
+        return false;
+    }
+
+    // apply = false : vérifie seulement la clé et la valeur, gameParam n'est pas modifié
+    bool assignGameParam(const std::string& key, const std::string& value, bool apply) {
+        for (const ParamEntry& entry : params) {
+            if (key != entry.name) continue;
+
+            const std::string text = trim(value);
+            if (int* const* i = std::get_if<int*>(&entry.value)) {
+                int parsed;
+                if (!parseInt(text, parsed)) return false;
+                if (apply) **i = parsed;
+                return true;
+            }
+            if (float* const* f = std::get_if<float*>(&entry.value)) {
+                float parsed;
+                if (!parseFloat(text, parsed)) return false;
+                if (apply) **f = parsed;
+                return true;
+            }
+            bool parsed;
+            if (!parseBool(text, parsed)) return false;
+            if (apply) *std::get<bool*>(entry.value) = parsed;
+            return true;
+        }
+        return false;
+    }
+
+    bool loadGameParamStream(std::istream& stream, const std::string& source, bool apply) {
+        bool ok = true;
+        std::string line;
+        int lineNumber = 0;
+        while (std::getline(stream, line)) {
+            lineNumber++;
+
+            size_t comment = line.find('#');
+            if (comment != std::string::npos) line.erase(comment);
+
+            size_t equal = line.find('=');
+            if (equal == std::string::npos) continue;
+
+            const std::string key = trim(line.substr(0, equal));
+            if (!isIdentifier(key)) continue;
+
+            if (!assignGameParam(key, line.substr(equal + 1), apply)) {
+                std::cerr << source << ":" << lineNumber << " : paramètre inconnu ou valeur invalide (" << key << ")" << std::endl;
+                ok = false;
+            }
+        }
+        return ok;
+    }
+}
+
+bool setGameParam(const std::string& key, const std::string& value) {
+    return assignGameParam(key, value, true);
+}
+
+bool loadGameParamFile(const std::string& path) {
+    std::ifstream file(path);
+    if (!file) {
+        std::cerr << "Erreur : impossible d'ouvrir le fichier " << path << std::endl;
+        return false;
+    }
+
+    return loadGameParamStream(file, path, true);
+}
+
+bool loadGameParamText(const std::string& text, const std::string& source) {
+    std::istringstream stream(text);
+    return loadGameParamStream(stream, source, true);
+}
+
+bool checkGameParamText(const std::string& text, const std::string& source) {
+    std::istringstream stream(text);
+    return loadGameParamStream(stream, source, false);
+}
+
+std::string gameParamText() {
+    std::string text;
+    char value[32];
+    for (const ParamEntry& entry : params) {
+        // alias d'une variable déjà écrite (grid_size)
+        bool alias = false;
+        for (const ParamEntry* other = params; other != &entry && !alias; ++other) {
+            alias = other->value == entry.value;
+        }
+        if (alias) continue;
+
+        if (int* const* i = std::get_if<int*>(&entry.value)) std::snprintf(value, sizeof(value), "%d", **i);
+        else if (float* const* f = std::get_if<float*>(&entry.value)) std::snprintf(value, sizeof(value), "%.9g", **f);
+        else std::snprintf(value, sizeof(value), "%d", *std::get<bool*>(entry.value) ? 1 : 0);
+
+        text += entry.name;
+        text += " = ";
+        text += value;
+        text += "\n";
+    }
+    return text;
+}
\ No newline at end of file
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <string>
+
+/**
+ * Lecture des paramètres de gameParam depuis du texte "cle = valeur"
+ * (même format que map_data.txt, les clés sont les noms des variables de gameParam).
+ */
+
+// false si la clé est inconnue ou la valeur invalide
+bool setGameParam(const std::string& key, const std::string& value);
+
+/**
+ * Applique toutes les lignes "cle = valeur" du fichier, "#" commence un commentaire.
+ * Les lignes dont la clé n'est pas un identifiant (statistiques de map_data.txt) sont ignorées.
+ * false si le fichier ne peut pas être ouvert ou contient un paramètre invalide.
+ */
+bool loadGameParamFile(const std::string& path);
+
+/**
+ * Tous les paramètres de gameParam en lignes "cle = valeur" (relisibles par loadGameParamText,
+ * les flottants gardent toute leur précision) : sauvegardés dans les snapshots
+ */
+std::string gameParamText();
+// comme loadGameParamFile, depuis un texte déjà en mémoire (source : nom pour les erreurs)
+bool loadGameParamText(const std::string& text, const std::string& source);
+// comme loadGameParamText sans rien modifier : true si loadGameParamText réussirait
+bool checkGameParamText(const std::string& text, const std::string& source);
\ No newline at end of file
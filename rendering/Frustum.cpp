@@ -0,0 +1,31 @@
+#include "Frustum.hpp"
+
+Frustum::Frustum(const glm::mat4& m) {
+    // lignes de la matrice (glm est en colonnes : m[colonne][ligne])
+    glm::vec4 rows[4];
+    for (int i = 0; i < 4; ++i) {
+        rows[i] = glm::vec4(m[0][i], m[1][i], m[2][i], m[3][i]);
+    }
+
+    planes[0] = rows[3] + rows[0]; // gauche
+    planes[1] = rows[3] - rows[0]; // droite
+    planes[2] = rows[3] + rows[1]; // bas
+    planes[3] = rows[3] - rows[1]; // haut
+    planes[4] = rows[3] + rows[2]; // proche
+    planes[5] = rows[3] - rows[2]; // lointain
+}
+
+bool Frustum::intersects(const glm::vec3& boxMin, const glm::vec3& boxMax) const {
+    for (const glm::vec4& plane : planes) {
+        // coin de la boîte le plus à l'intérieur du plan
+        glm::vec3 p(
+            plane.x >= 0.0f ? boxMax.x : boxMin.x,
+            plane.y >= 0.0f ? boxMax.y : boxMin.y,
+            plane.z >= 0.0f ? boxMax.z : boxMin.z
+        );
+        if (plane.x * p.x + plane.y * p.y + plane.z * p.z + plane.w < 0.0f) {
+            return false;
+        }
+    }
+    return true;
+}
\ No newline at end of file
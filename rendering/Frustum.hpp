@@ -0,0 +1,21 @@
+#ifndef FRUSTUM_HPP
+#define FRUSTUM_HPP
+
+#include <glm/glm.hpp>
+
+/**
+ * Pyramide de vue extraite d'une matrice projection * view (6 plans, normales vers l'intérieur).
+ * Sert à écarter les boîtes entièrement hors de l'écran avant de les dessiner.
+ */
+class Frustum {
+public:
+    explicit Frustum(const glm::mat4& viewProjection);
+
+    // false seulement si la boîte est entièrement hors de la vue (test conservateur)
+    bool intersects(const glm::vec3& boxMin, const glm::vec3& boxMax) const;
+
+private:
+    glm::vec4 planes[6]; // ax + by + cz + d >= 0 à l'intérieur
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,164 @@
+#include "GpuBuffer.hpp"
+
+#include <utility>
+#include <vector>
+#include <glad/glad.h>
+
+namespace {
+    struct PooledBuffer {
+        unsigned int handle;
+        size_t bytes;
+    };
+
+    // plus de buffers en réserve que ça : les plus petits sont supprimés
+    constexpr size_t MAX_POOLED_BUFFERS = 16;
+
+    std::vector<PooledBuffer> pool;
+    gpuMemory::Stats counters;
+    bool contextAlive = true;
+
+    // plus petit buffer de la réserve d'au moins bytes octets, 0 si aucun
+    PooledBuffer takeFromPool(size_t bytes) {
+        int best = -1;
+        for (int i = 0; i < static_cast<int>(pool.size()); ++i) {
+            if (pool[i].bytes >= bytes && (best < 0 || pool[i].bytes < pool[best].bytes)) {
+                best = i;
+            }
+        }
+        if (best < 0) return PooledBuffer{0, 0};
+
+        PooledBuffer buffer = pool[best];
+        pool[best] = pool.back();
+        pool.pop_back();
+
+        counters.pooledBuffers--;
+        counters.pooledBytes -= buffer.bytes;
+        return buffer;
+    }
+
+    void giveToPool(unsigned int handle, size_t bytes) {
+        if (!contextAlive) return;
+
+        if (pool.size() == MAX_POOLED_BUFFERS) {
+            // on garde les plus gros, ce sont ceux qui coûtent le plus à réallouer
+            int smallest = 0;
+            for (int i = 1; i < static_cast<int>(pool.size()); ++i) {
+                if (pool[i].bytes < pool[smallest].bytes) smallest = i;
+            }
+            if (pool[smallest].bytes >= bytes) {
+                glDeleteBuffers(1, &handle);
+                return;
+            }
+            glDeleteBuffers(1, &pool[smallest].handle);
+            counters.pooledBuffers--;
+            counters.pooledBytes -= pool[smallest].bytes;
+            pool[smallest] = pool.back();
+            pool.pop_back();
+        }
+
+        pool.push_back(PooledBuffer{handle, bytes});
+        counters.pooledBuffers++;
+        counters.pooledBytes += bytes;
+    }
+}
+
+/* ----- GpuBuffer ----- */
+
+GpuBuffer::~GpuBuffer() {
+    reset();
+}
+
+GpuBuffer::GpuBuffer(GpuBuffer&& other) noexcept
+    : handle(std::exchange(other.handle, 0)), bytes(std::exchange(other.bytes, 0)) {}
+
+GpuBuffer& GpuBuffer::operator=(GpuBuffer&& other) noexcept {
+    if (this != &other) {
+        reset();
+        handle = std::exchange(other.handle, 0);
+        bytes = std::exchange(other.bytes, 0);
+    }
+    return *this;
+}
+
+void GpuBuffer::upload(unsigned int target, const void* data, size_t size, unsigned int usage) {
+    if (size > bytes) {
+        reset();
+
+        PooledBuffer reused = takeFromPool(size);
+        if (reused.handle != 0) {
+            handle = reused.handle;
+            bytes = reused.bytes;
+        } else {
+            glGenBuffers(1, &handle);
+            glBindBuffer(target, handle);
+            glBufferData(target, size, data, usage);
+            bytes = size;
+        }
+        counters.buffers++;
+        counters.bufferBytes += bytes;
+
+        if (reused.handle == 0) return;
+    }
+
+    glBindBuffer(target, handle);
+    glBufferSubData(target, 0, size, data);
+}
+
+void GpuBuffer::reset() {
+    if (handle == 0) return;
+
+    counters.buffers--;
+    counters.bufferBytes -= bytes;
+    giveToPool(handle, bytes);
+
+    handle = 0;
+    bytes = 0;
+}
+
+/* ----- VertexArray ----- */
+
+VertexArray::~VertexArray() {
+    reset();
+}
+
+VertexArray::VertexArray(VertexArray&& other) noexcept
+    : handle(std::exchange(other.handle, 0)) {}
+
+VertexArray& VertexArray::operator=(VertexArray&& other) noexcept {
+    if (this != &other) {
+        reset();
+        handle = std::exchange(other.handle, 0);
+    }
+    return *this;
+}
+
+void VertexArray::create() {
+    if (handle != 0) return;
+    glGenVertexArrays(1, &handle);
+    counters.vertexArrays++;
+}
+
+void VertexArray::reset() {
+    if (handle == 0) return;
+
+    if (contextAlive) glDeleteVertexArrays(1, &handle);
+    counters.vertexArrays--;
+    handle = 0;
+}
+
+/* ----- gpuMemory ----- */
+
+gpuMemory::Stats gpuMemory::stats() {
+    return counters;
+}
+
+void gpuMemory::shutdown() {
+    for (PooledBuffer& buffer : pool) {
+        glDeleteBuffers(1, &buffer.handle);
+    }
+    pool.clear();
+    counters.pooledBuffers = 0;
+    counters.pooledBytes = 0;
+
+    contextAlive = false;
+}
\ No newline at end of file
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstddef>
+
+/**
+ * Buffers OpenGL possédés (RAII) : un GpuBuffer libère son buffer en étant détruit,
+ * il ne peut être que déplacé.
+ * Un buffer libéré n'est pas supprimé mais rendu à une réserve commune, le prochain
+ * upload qui a besoin de place reprend un buffer assez grand de la réserve
+ * au lieu d'en allouer un nouveau (les régénérations de carte réutilisent donc les mêmes allocations).
+ */
+class GpuBuffer {
+public:
+    GpuBuffer() = default;
+    ~GpuBuffer();
+
+    GpuBuffer(GpuBuffer&& other) noexcept;
+    GpuBuffer& operator=(GpuBuffer&& other) noexcept;
+    GpuBuffer(const GpuBuffer&) = delete;
+    GpuBuffer& operator=(const GpuBuffer&) = delete;
+
+    /**
+     * Envoie bytes octets dans le buffer (lié à target).
+     * L'allocation n'est refaite que si le buffer actuel est trop petit.
+     */
+    void upload(unsigned int target, const void* data, size_t bytes, unsigned int usage);
+    // rend le buffer à la réserve
+    void reset();
+
+    unsigned int id() const { return handle; }
+    size_t capacity() const { return bytes; }
+
+private:
+    unsigned int handle = 0;
+    size_t bytes = 0;
+};
+
+// VAO possédé (RAII), supprimé en étant détruit
+class VertexArray {
+public:
+    VertexArray() = default;
+    ~VertexArray();
+
+    VertexArray(VertexArray&& other) noexcept;
+    VertexArray& operator=(VertexArray&& other) noexcept;
+    VertexArray(const VertexArray&) = delete;
+    VertexArray& operator=(const VertexArray&) = delete;
+
+    // crée le VAO au premier appel
+    void create();
+    void reset();
+
+    unsigned int id() const { return handle; }
+
+private:
+    unsigned int handle = 0;
+};
+
+namespace gpuMemory {
+    struct Stats {
+        int buffers = 0;        // buffers utilisés
+        size_t bufferBytes = 0;
+        int pooledBuffers = 0;  // buffers en réserve
+        size_t pooledBytes = 0;
+        int vertexArrays = 0;
+    };
+
+    Stats stats();
+
+    /**
+     * Supprime la réserve, à appeler avant de détruire le contexte OpenGL.
+     * Les handles encore vivants après l'appel (globales) sont abandonnés sans appel OpenGL.
+     */
+    void shutdown();
+}
\ No newline at end of file
@@ -2,18 +2,15 @@
 #include "../configuration.hpp"
 
 #include <glad/glad.h>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
 
 void initObject(ObjData& obj) {
-    glGenVertexArrays(1, &obj.VAO);
-    glGenBuffers(1, &obj.VBO);
-    glGenBuffers(1, &obj.EBO);
+    obj.VAO.create();
 
-    glBindVertexArray(obj.VAO);
-    glBindBuffer(GL_ARRAY_BUFFER, obj.VBO);
-    glBufferData(GL_ARRAY_BUFFER, obj.vertices.size() * sizeof(Vertex), obj.vertices.data(), GL_STATIC_DRAW);
-
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, obj.EBO);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, obj.indices.size() * sizeof(unsigned int), obj.indices.data(), GL_STATIC_DRAW);
+    glBindVertexArray(obj.VAO.id());
+    obj.VBO.upload(GL_ARRAY_BUFFER, obj.vertices.data(), obj.vertices.size() * sizeof(Vertex), GL_STATIC_DRAW);
+    obj.EBO.upload(GL_ELEMENT_ARRAY_BUFFER, obj.indices.data(), obj.indices.size() * sizeof(unsigned int), GL_STATIC_DRAW);
 
     // Position
     glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)0);
@@ -32,19 +29,22 @@ void initObject(ObjData& obj) {
 }
 
 void drawObject(ObjData& obj) {
-    glBindVertexArray(obj.VAO);
+    glBindVertexArray(obj.VAO.id());
     glDrawElements(GL_TRIANGLES, obj.indices.size(), GL_UNSIGNED_INT, 0);
     glBindVertexArray(0);
 }
 
 /* -------------------------------------------------------------- */
 
-ObjData createSquare(float height, glm::vec3 color) {
+ObjData createSquare(glm::vec3 color) {
     ObjData obj;
     float mult = 50.0f;
 
     float size = ((conf::game_window_width * 1.1f) / 2.0f) / mult;
 
+    // à la hauteur 0 : à placer avec la matrice model
+    const float height = 0.0f;
+
     // Centre du carré
     float center = (conf::game_window_width / 2.0f) / mult;
 
@@ -63,4 +63,15 @@ ObjData createSquare(float height, glm::vec3 color) {
 
     initObject(obj);
     return obj;
+}
+
+void drawPlane(unsigned int shaderProgram, ObjData& plane, float height) {
+    int modelLoc = glGetUniformLocation(shaderProgram, "model");
+
+    glm::mat4 model = glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, height, 0.0f));
+    glUniformMatrix4fv(modelLoc, 1, GL_FALSE, glm::value_ptr(model));
+    drawObject(plane);
+
+    glm::mat4 identity = glm::mat4(1.0f);
+    glUniformMatrix4fv(modelLoc, 1, GL_FALSE, glm::value_ptr(identity));
 }
\ No newline at end of file
@@ -4,4 +4,7 @@
 
 void initObject(ObjData& obj);
 void drawObject(ObjData& obj);
-ObjData createSquare(float height, glm::vec3 color);
\ No newline at end of file
+// plan horizontal qui couvre la carte, à créer une seule fois
+ObjData createSquare(glm::vec3 color);
+// dessine un plan de createSquare à la hauteur donnée (via la matrice model)
+void drawPlane(unsigned int shaderProgram, ObjData& plane, float height);
\ No newline at end of file
@@ -1,11 +1,15 @@
 #include "guiParameter.hpp"
 #include "../gameParam.hpp"
 #include "../environment/map.hpp"
+#include "GpuBuffer.hpp"
+#include "tileRenderer.hpp"
+#include <cfloat>
 #include <imgui.h>
 
 void createParameter() {
     mapParameter();
     debuggingParameter();
+    statisticsPanel();
 }
 
 void mapParameter() {
@@ -13,7 +17,7 @@ void mapParameter() {
     ImGui::Begin("Paramètres de la carte");
     ImGui::Spacing();
 
-    if (ImGui::SliderInt("Dimension", &gameParam::map_size, 5, 99))
+    if (ImGui::SliderInt("Dimension", &gameParam::map_size, 5, 512))
         createHexmap();
 
     if (ImGui::SliderInt("Seed", &gameParam::map_seed, 0, 250))
@@ -42,13 +46,11 @@ void mapParameter() {
     if (ImGui::SliderInt("Nombre de value noise", &gameParam::nbVN, 1, 10))
         createHexmap();
 
+    // affichage seulement (uniforms du shader) : pas de régénération
     ImGui::Spacing();
-    if (ImGui::SliderFloat("Température minimale", &gameParam::min_temp, -100.0f, 100.0f))
-        createHexmap();
-    if (ImGui::SliderFloat("Température maximale", &gameParam::max_temp, -100.0f, 100.0f))
-        createHexmap();
-    if (ImGui::SliderFloat("Précipitation maximale", &gameParam::max_precipitation, 0.0f, 2500.0f))
-        createHexmap();
+    ImGui::SliderFloat("Température minimale", &gameParam::min_temp, -100.0f, 100.0f);
+    ImGui::SliderFloat("Température maximale", &gameParam::max_temp, -100.0f, 100.0f);
+    ImGui::SliderFloat("Précipitation maximale", &gameParam::max_precipitation, 0.0f, 2500.0f);
 
     ImGui::End();
 }
@@ -60,8 +62,7 @@ void debuggingParameter() {
     ImGui::Spacing();
     ImGui::Text("Couleur des tiles : ");
     static const char* items[] = { "Biome", "Hauteur", "Température", "Précipitation" };
-    if (ImGui::Combo("##TileColor", &gameParam::tile_color, items, IM_ARRAYSIZE(items)))
-        createHexmap();
+    ImGui::Combo("##TileColor", &gameParam::tile_color, items, IM_ARRAYSIZE(items));
 
     ImGui::Spacing();
     ImGui::Checkbox("montrer la hauteur de l'eau", &gameParam::showWaterLevel);
@@ -69,5 +70,65 @@ void debuggingParameter() {
     ImGui::Spacing();
     ImGui::Checkbox("montrer la hauteur maximal", &gameParam::showMaxHeight);
 
+    ImGui::Spacing();
+    ImGui::Text(isGeneratingHexmap() ? "Génération en cours..." : "Dernière génération : ");
+    for (const StageReport& stage : map::generationReport) {
+        if (stage.ran) {
+            ImGui::Text("  %s : %.2f ms", stage.name, stage.durationMs);
+        } else {
+            ImGui::TextDisabled("  %s : en cache", stage.name);
+        }
+    }
+
+    ImGui::Spacing();
+    const TileRenderStats tiles = tileRenderStats();
+    ImGui::Text("Rendu des tiles : ");
+    int drawnChunks = tiles.chunks[0] + tiles.chunks[1] + tiles.chunks[2];
+    ImGui::Text("  chunks dessinés / hors de la vue : %d / %d", drawnChunks, tiles.culledChunks);
+    ImGui::Text("  chunks détaillés / simples / plats : %d / %d / %d", tiles.chunks[0], tiles.chunks[1], tiles.chunks[2]);
+    ImGui::Text("  %d appels, %lld triangles", tiles.drawCalls, tiles.triangles);
+
+    ImGui::Spacing();
+    const gpuMemory::Stats gpu = gpuMemory::stats();
+    ImGui::Text("Mémoire GPU : ");
+    ImGui::Text("  %d buffers : %.1f Ko", gpu.buffers, gpu.bufferBytes / 1024.0);
+    ImGui::Text("  %d en réserve : %.1f Ko", gpu.pooledBuffers, gpu.pooledBytes / 1024.0);
+    ImGui::Text("  %d VAO", gpu.vertexArrays);
+
     ImGui::End();
 }
+
+static void valueStatistics(const char* name, const ValueStatistics& value) {
+    if (!ImGui::CollapsingHeader(name)) return;
+
+    ImGui::Text("  min %.2f   max %.2f   moyenne %.2f", value.stats.min(), value.stats.max(), value.stats.mean());
+    ImGui::Text("  10%% %.2f   médiane %.2f   90%% %.2f",
+        value.quantiles.quantile(0.1f), value.quantiles.quantile(0.5f), value.quantiles.quantile(0.9f));
+
+    float bins[ValueStatistics::NB_BINS];
+    for (int i = 0; i < ValueStatistics::NB_BINS; ++i) bins[i] = static_cast<float>(value.histogram[i]);
+    ImGui::PlotHistogram("##histogram", bins, ValueStatistics::NB_BINS, 0, nullptr, 0.0f, FLT_MAX, ImVec2(0, 60));
+    ImGui::Text("  %.0f ... %.0f", value.histogram.rangeLow(), value.histogram.rangeHigh());
+}
+
+void statisticsPanel() {
+    ImGui::SetNextWindowPos(ImVec2(30, 500), ImGuiCond_Once);
+    ImGui::Begin("statistiques de la carte");
+
+    const MapStatistics& statistics = map::statistics;
+    const long long nbTiles = statistics.height.stats.count();
+
+    ImGui::Text("Biomes : ");
+    for (int type = 0; type < statistics.biomes.size(); ++type) {
+        int count = statistics.biomes[type];
+        if (count == 0) continue;
+        ImGui::Text("  %s : %d (%.1f %%)", getBiome(static_cast<BiomeType>(type)).name.c_str(), count, 100.0 * count / nbTiles);
+    }
+
+    ImGui::Spacing();
+    valueStatistics("Hauteur", statistics.height);
+    valueStatistics("Température", statistics.temperature);
+    valueStatistics("Précipitation", statistics.precipitation);
+
+    ImGui::End();
+}
\ No newline at end of file
@@ -2,4 +2,5 @@
 
 void createParameter();
 void mapParameter();
-void debuggingParameter();
\ No newline at end of file
+void debuggingParameter();
+void statisticsPanel();
\ No newline at end of file
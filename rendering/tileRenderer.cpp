@@ -0,0 +1,320 @@
+#include "tileRenderer.hpp"
+#include "graphicUtils.hpp"
+#include "Frustum.hpp"
+#include "../gameParam.hpp"
+#include "../environment/Biome.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <string>
+#include <glad/glad.h>
+
+/**
+ * Choix du niveau de détail : taille à l'écran d'une tile, mesurée par le nombre de
+ * rayons de tile visibles sur une demi-hauteur d'écran à la distance du chunk.
+ * Au-delà de lodThresholds[l] le chunk passe au niveau l + 1.
+ * L'hystérésis décale le seuil selon le sens du changement, un chunk à la limite
+ * ne change donc pas de niveau à chaque frame.
+ */
+static const float lodThresholds[] = {40.0f, 160.0f};
+static const float lodHysteresis = 0.15f;
+
+struct TileChunk {
+    int first;           // première instance (les instances d'un chunk sont contiguës)
+    int count;
+    glm::vec2 center;    // x, z
+    glm::vec2 boundsMin; // emprise x, z (rayon des tiles compris)
+    glm::vec2 boundsMax;
+    TileAttributes minValues; // bornes des valeurs des tiles : la hauteur affichée en dépend
+    TileAttributes maxValues;
+    TileLod lod = TileLod::High;
+    bool visible = true;
+};
+
+static ObjData lodMeshes[static_cast<int>(TileLod::Count)];
+
+static std::vector<TileChunk> chunks;
+static float tileRadius = 1.0f;
+
+static GpuBuffer instanceBuffer;
+static GpuBuffer attributeBuffer;
+static unsigned int attributeTexture = 0;
+static unsigned int attachedAttributes = 0; // buffer branché sur la texture
+
+// instances et valeurs réordonnées chunk par chunk avant l'envoi
+static std::vector<TileInstance> sortedInstances;
+static std::vector<TileAttributes> sortedAttributes;
+
+static TileRenderStats lastStats;
+
+/* ----- modèles ----- */
+
+// hexagone plat à la hauteur du dessus du modèle détaillé (mêmes coins que son dessus)
+static ObjData createFlatHexagon(const ObjData& highModel) {
+    float top = -1e30f;
+    for (const Vertex& v : highModel.vertices) top = std::max(top, v.position.y);
+
+    float radius = 0.0f;
+    for (const Vertex& v : highModel.vertices) {
+        if (v.position.y == top) {
+            radius = std::max(radius, std::sqrt(v.position.x * v.position.x + v.position.z * v.position.z));
+        }
+    }
+
+    ObjData hexagon;
+    const glm::vec3 up(0.0f, 1.0f, 0.0f);
+    hexagon.vertices.push_back({glm::vec3(0.0f, top, 0.0f), up, glm::vec2(0.5f), glm::vec3(0.0f)});
+    for (int k = 0; k < 6; ++k) {
+        // coins à 30° + k * 60° (tiles en pointe vers le haut, comme le modèle)
+        float angle = glm::radians(30.0f + 60.0f * k);
+        glm::vec3 corner(radius * std::cos(angle), top, radius * std::sin(angle));
+        hexagon.vertices.push_back({corner, up, glm::vec2(0.5f), glm::vec3(0.0f)});
+    }
+    // sens anti-horaire vu du dessus
+    for (unsigned int k = 0; k < 6; ++k) {
+        hexagon.indices.push_back(0);
+        hexagon.indices.push_back(1 + (k + 1) % 6);
+        hexagon.indices.push_back(1 + k);
+    }
+    return hexagon;
+}
+
+static void initLodMesh(TileLod lod, const ObjData& model) {
+    ObjData& mesh = lodMeshes[static_cast<int>(lod)];
+    mesh.vertices = model.vertices;
+    mesh.indices = model.indices;
+    initObject(mesh);
+
+    // attributs par instance (un pas par tile), les pointeurs sont donnés à chaque appel
+    glBindVertexArray(mesh.VAO.id());
+    glEnableVertexAttribArray(4);
+    glVertexAttribDivisor(4, 1);
+    glEnableVertexAttribArray(5);
+    glVertexAttribDivisor(5, 1);
+    glBindVertexArray(0);
+}
+
+void initTileRenderer(unsigned int shaderProgram, const ObjData& highModel, const ObjData& lowModel) {
+    initLodMesh(TileLod::High, highModel);
+    initLodMesh(TileLod::Low, lowModel);
+    initLodMesh(TileLod::Flat, createFlatHexagon(highModel));
+
+    glGenTextures(1, &attributeTexture);
+
+    // couleurs des biomes, indexées par BiomeType
+    glUseProgram(shaderProgram);
+    for (int i = 0; i <= static_cast<int>(BiomeType::None); ++i) {
+        std::string name = "biomeColors[" + std::to_string(i) + "]";
+        glm::vec3 color = getBiome(static_cast<BiomeType>(i)).color;
+        glUniform3f(glGetUniformLocation(shaderProgram, name.c_str()), color.x, color.y, color.z);
+    }
+    glUniform1i(glGetUniformLocation(shaderProgram, "tileData"), 0);
+    glUseProgram(0);
+}
+
+/* ----- envoi des tiles ----- */
+
+void uploadTileInstances(const HexGrid& grid, const std::vector<TileInstance>& instances, const std::vector<TileAttributes>& attributes) {
+    chunks.clear();
+    if (instances.empty()) return;
+
+    const int chunksPerSide = (grid.size() + TILE_CHUNK_SIZE - 1) / TILE_CHUNK_SIZE;
+    const int nbChunks = chunksPerSide * chunksPerSide;
+
+    // tri par comptage des tiles selon leur chunk
+    std::vector<int> chunkOf(instances.size());
+    std::vector<int> offsets(nbChunks + 1, 0);
+    for (const Tile& tile : grid) {
+        int row = static_cast<int>(tile.hexCoord.y);
+        int col = static_cast<int>(std::floor(tile.hexCoord.x));
+        chunkOf[tile.index] = (row / TILE_CHUNK_SIZE) * chunksPerSide + col / TILE_CHUNK_SIZE;
+        offsets[chunkOf[tile.index] + 1]++;
+    }
+    for (int c = 0; c < nbChunks; ++c) offsets[c + 1] += offsets[c];
+
+    chunks.resize(nbChunks);
+    for (int c = 0; c < nbChunks; ++c) {
+        chunks[c].first = offsets[c];
+        chunks[c].count = offsets[c + 1] - offsets[c];
+        chunks[c].center = glm::vec2(0.0f);
+        chunks[c].boundsMin = glm::vec2(1e30f);
+        chunks[c].boundsMax = glm::vec2(-1e30f);
+        chunks[c].minValues = TileAttributes{1e30f, 1e30f, 1e30f, 0.0f};
+        chunks[c].maxValues = TileAttributes{-1e30f, -1e30f, -1e30f, 0.0f};
+        chunks[c].lod = TileLod::High;
+    }
+
+    sortedInstances.resize(instances.size());
+    sortedAttributes.resize(attributes.size());
+    for (size_t i = 0; i < instances.size(); ++i) {
+        int slot = offsets[chunkOf[i]]++;
+        sortedInstances[slot] = instances[i];
+        sortedAttributes[slot] = attributes[i];
+
+        TileChunk& chunk = chunks[chunkOf[i]];
+        const glm::vec2 position = instances[i].position;
+        const float radius = instances[i].radius;
+        chunk.center += position;
+        chunk.boundsMin = glm::vec2(std::min(chunk.boundsMin.x, position.x - radius), std::min(chunk.boundsMin.y, position.y - radius));
+        chunk.boundsMax = glm::vec2(std::max(chunk.boundsMax.x, position.x + radius), std::max(chunk.boundsMax.y, position.y + radius));
+
+        const TileAttributes& values = attributes[i];
+        chunk.minValues.height = std::min(chunk.minValues.height, values.height);
+        chunk.maxValues.height = std::max(chunk.maxValues.height, values.height);
+        chunk.minValues.temperature = std::min(chunk.minValues.temperature, values.temperature);
+        chunk.maxValues.temperature = std::max(chunk.maxValues.temperature, values.temperature);
+        chunk.minValues.precipitation = std::min(chunk.minValues.precipitation, values.precipitation);
+        chunk.maxValues.precipitation = std::max(chunk.maxValues.precipitation, values.precipitation);
+    }
+
+    // les chunks vides (bord droit des lignes impaires) ne sont jamais dessinés
+    chunks.erase(std::remove_if(chunks.begin(), chunks.end(), [](const TileChunk& c) { return c.count == 0; }), chunks.end());
+    for (TileChunk& chunk : chunks) {
+        chunk.center /= static_cast<float>(chunk.count);
+    }
+    tileRadius = instances[0].radius;
+
+    // les buffers ne sont réalloués (ou repris de la réserve) que s'ils deviennent trop petits
+    instanceBuffer.upload(GL_ARRAY_BUFFER, sortedInstances.data(), sortedInstances.size() * sizeof(TileInstance), GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    attributeBuffer.upload(GL_TEXTURE_BUFFER, sortedAttributes.data(), sortedAttributes.size() * sizeof(TileAttributes), GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_TEXTURE_BUFFER, 0);
+
+    if (attributeBuffer.id() != attachedAttributes) {
+        glBindTexture(GL_TEXTURE_BUFFER, attributeTexture);
+        glTexBuffer(GL_TEXTURE_BUFFER, GL_RGBA32F, attributeBuffer.id());
+        glBindTexture(GL_TEXTURE_BUFFER, 0);
+        attachedAttributes = attributeBuffer.id();
+    }
+}
+
+/* ----- visibilité ----- */
+
+// hauteurs min et max affichées dans le chunk, mêmes formules que vertex.glsl selon tile_color
+static void chunkHeightRange(const TileChunk& chunk, float& low, float& high) {
+    float a, b;
+    switch (gameParam::tile_color) {
+        case 0:   // Biome : les bords descendent jusqu'au sol
+            low = std::min(0.0f, chunk.minValues.height);
+            high = chunk.maxValues.height;
+            return;
+        case 1:   // Hauteur
+            a = chunk.minValues.height;
+            b = chunk.maxValues.height;
+            break;
+        case 2:   // Température
+            a = (chunk.minValues.temperature - gameParam::min_temp) / (gameParam::max_temp - gameParam::min_temp);
+            b = (chunk.maxValues.temperature - gameParam::min_temp) / (gameParam::max_temp - gameParam::min_temp);
+            break;
+        default:  // Précipitation
+            a = chunk.minValues.precipitation / gameParam::max_precipitation;
+            b = chunk.maxValues.precipitation / gameParam::max_precipitation;
+            break;
+    }
+    // bornes dans les deux sens : min > max possible avec les sliders
+    low = std::min(a, b) * 5.0f;
+    high = std::max(a, b) * 5.0f;
+}
+
+static void cullChunks(const glm::mat4& viewProjection) {
+    const Frustum frustum(viewProjection);
+
+    for (TileChunk& chunk : chunks) {
+        float low, high;
+        chunkHeightRange(chunk, low, high);
+        // le dessus du modèle dépasse la hauteur de la tile d'une fraction du rayon
+        chunk.visible = frustum.intersects(
+            glm::vec3(chunk.boundsMin.x, low - tileRadius, chunk.boundsMin.y),
+            glm::vec3(chunk.boundsMax.x, high + tileRadius, chunk.boundsMax.y)
+        );
+    }
+}
+
+/* ----- niveau de détail ----- */
+
+static void updateLods(const Camera& camera) {
+    const glm::vec3 eye = camera.getPosition();
+    const float halfHeight = std::tan(glm::radians(camera.focalLenth) / 2.0f);
+    const int nbLods = static_cast<int>(TileLod::Count);
+
+    for (TileChunk& chunk : chunks) {
+        glm::vec3 center(chunk.center.x, 0.0f, chunk.center.y);
+        float distance = glm::length(center - eye);
+        // rayons de tile visibles sur une demi-hauteur d'écran
+        float tilesOnScreen = distance * halfHeight / tileRadius;
+
+        int lod = static_cast<int>(chunk.lod);
+        while (lod + 1 < nbLods && tilesOnScreen > lodThresholds[lod] * (1.0f + lodHysteresis)) lod++;
+        while (lod > 0 && tilesOnScreen < lodThresholds[lod - 1] * (1.0f - lodHysteresis)) lod--;
+        chunk.lod = static_cast<TileLod>(lod);
+    }
+}
+
+/* ----- dessin ----- */
+
+// dessine count instances à partir de first avec le modèle du niveau lod
+static void drawInstanceRange(unsigned int shaderProgram, TileLod lod, int first, int count) {
+    const ObjData& mesh = lodMeshes[static_cast<int>(lod)];
+
+    glBindVertexArray(mesh.VAO.id());
+
+    // OpenGL 3.3 n'a pas de baseInstance : le début de la plage est donné par le décalage
+    // des attributs d'instance et par instanceOffset pour le texture buffer
+    glBindBuffer(GL_ARRAY_BUFFER, instanceBuffer.id());
+    size_t offset = static_cast<size_t>(first) * sizeof(TileInstance);
+    glVertexAttribPointer(4, 2, GL_FLOAT, GL_FALSE, sizeof(TileInstance), (void*)(offset + offsetof(TileInstance, position)));
+    glVertexAttribPointer(5, 1, GL_FLOAT, GL_FALSE, sizeof(TileInstance), (void*)(offset + offsetof(TileInstance, radius)));
+    glUniform1i(glGetUniformLocation(shaderProgram, "instanceOffset"), first);
+
+    glDrawElementsInstanced(GL_TRIANGLES, mesh.indices.size(), GL_UNSIGNED_INT, 0, count);
+
+    lastStats.drawCalls++;
+    lastStats.triangles += static_cast<long long>(mesh.indices.size() / 3) * count;
+}
+
+void drawTiles(unsigned int shaderProgram, const Camera& camera, const glm::mat4& viewProjection) {
+    lastStats = TileRenderStats();
+    if (chunks.empty()) return;
+
+    cullChunks(viewProjection);
+    updateLods(camera);
+
+    glUniform1i(glGetUniformLocation(shaderProgram, "instanced"), 1);
+    glUniform1i(glGetUniformLocation(shaderProgram, "tileColor"), gameParam::tile_color);
+    glUniform1f(glGetUniformLocation(shaderProgram, "minTemp"), gameParam::min_temp);
+    glUniform1f(glGetUniformLocation(shaderProgram, "maxTemp"), gameParam::max_temp);
+    glUniform1f(glGetUniformLocation(shaderProgram, "maxPrecipitation"), gameParam::max_precipitation);
+
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_BUFFER, attributeTexture);
+
+    // chunks visibles consécutifs de même niveau : contigus dans les buffers, un seul appel
+    size_t c = 0;
+    while (c < chunks.size()) {
+        if (!chunks[c].visible) {
+            lastStats.culledChunks++;
+            c++;
+            continue;
+        }
+
+        const TileLod lod = chunks[c].lod;
+        const int first = chunks[c].first;
+        int count = 0;
+        for (; c < chunks.size() && chunks[c].visible && chunks[c].lod == lod; ++c) {
+            count += chunks[c].count;
+            lastStats.chunks[static_cast<int>(lod)]++;
+        }
+        drawInstanceRange(shaderProgram, lod, first, count);
+    }
+
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    glUniform1i(glGetUniformLocation(shaderProgram, "instanced"), 0);
+}
+
+TileRenderStats tileRenderStats() {
+    return lastStats;
+}
\ No newline at end of file
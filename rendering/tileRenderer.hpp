@@ -0,0 +1,46 @@
+#pragma once
+
+#include <vector>
+
+#include "Camera.hpp"
+#include "../environment/HexGrid.hpp"
+#include "../environment/TileRenderData.hpp"
+#include "../object/ObjData.hpp"
+
+/**
+ * Rendu instancié de la carte : les modèles de tile sont envoyés une seule fois,
+ * chaque tile n'est plus qu'une instance (position, rayon).
+ * Les valeurs des tiles (hauteur, température, précipitation, biome) sont dans un
+ * texture buffer : le shader en déduit la couleur et la hauteur selon le mode
+ * d'affichage, changer de mode ne coûte que des uniforms.
+ *
+ * La carte est découpée en chunks de TILE_CHUNK_SIZE x TILE_CHUNK_SIZE tiles, contigus
+ * dans les buffers : les chunks hors de la vue (boîte englobante hors du frustum) sont
+ * écartés, les autres choisissent leur niveau de détail selon la caméra et les chunks
+ * voisins de même niveau sont dessinés en un seul appel.
+ */
+inline constexpr int TILE_CHUNK_SIZE = 16;
+
+// niveaux de détail, du plus fin au plus grossier
+enum class TileLod : int {
+    High,  // tile_high.obj
+    Low,   // tile_low.obj
+    Flat,  // hexagone plat (dessus de la tile seulement)
+    Count,
+};
+
+struct TileRenderStats {
+    int chunks[static_cast<int>(TileLod::Count)] = {}; // chunks dessinés, par niveau
+    int culledChunks = 0;
+    int drawCalls = 0;
+    long long triangles = 0;
+};
+
+void initTileRenderer(unsigned int shaderProgram, const ObjData& highModel, const ObjData& lowModel);
+void uploadTileInstances(const HexGrid& grid, const std::vector<TileInstance>& instances, const std::vector<TileAttributes>& attributes);
+// mode d'affichage et bornes lus dans gameParam (tile_color, min_temp, max_temp, max_precipitation)
+// viewProjection : projection * view de la frame, pour écarter les chunks hors de la vue
+void drawTiles(unsigned int shaderProgram, const Camera& camera, const glm::mat4& viewProjection);
+
+// statistiques du dernier drawTiles
+TileRenderStats tileRenderStats();
\ No newline at end of file
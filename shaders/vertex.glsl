@@ -4,19 +4,68 @@ layout(location = 1) in vec3 aNormal;
 layout(location = 2) in vec2 aTexCoords;
 layout(location = 3) in vec3 aColor;
 
+// par instance (rendu des tiles)
+layout(location = 4) in vec2 aInstancePos;
+layout(location = 5) in float aInstanceRadius;
+
 uniform mat4 model;
 uniform mat4 view;
 uniform mat4 projection;
 
+uniform bool instanced;
+
+// valeurs des tiles, une texel par instance : hauteur, température, précipitation, biome
+uniform samplerBuffer tileData;
+uniform int instanceOffset; // première instance de l'appel (pas de baseInstance en 3.3)
+uniform vec3 biomeColors[11];
+
+// mode d'affichage : 0 Biome, 1 Hauteur, 2 Température, 3 Précipitation
+uniform int tileColor;
+uniform float minTemp;
+uniform float maxTemp;
+uniform float maxPrecipitation;
+
 out vec3 FragPos;
 out vec3 Normal;
 out vec3 VertexColor;
 
 void main()
 {
-    FragPos = vec3(model * vec4(aPos, 1.0));
-    Normal = mat3(transpose(inverse(model))) * aNormal;
+    vec3 pos = aPos;
     VertexColor = aColor;
+
+    if (instanced) {
+        vec4 data = texelFetch(tileData, gl_InstanceID + instanceOffset);
+
+        float height;
+        if (tileColor == 0) {
+            height = data.x;
+            VertexColor = biomeColors[int(data.w)];
+        } else {
+            float c;
+            if (tileColor == 1)      c = data.x;
+            else if (tileColor == 2) c = (data.y - minTemp) / (maxTemp - minTemp);
+            else                     c = data.z / maxPrecipitation;
+
+            height = c * 5.0;
+            VertexColor = vec3(c, c, c);
+        }
+
+        vec3 top = vec3(aInstancePos.x, height, aInstancePos.y);
+        pos = aPos * aInstanceRadius + top;
+
+        // bords de la tile : jusqu'au sol en mode Biome, écrasés sur le dessus sinon
+        if (pos.y < height) {
+            if (tileColor == 0) {
+                pos.y = 0.0;
+            } else {
+                pos = top;
+            }
+        }
+    }
+
+    FragPos = vec3(model * vec4(pos, 1.0));
+    Normal = mat3(transpose(inverse(model))) * aNormal;
     
     gl_Position = projection * view * vec4(FragPos, 1.0);
 }
@@ -0,0 +1,108 @@
+#pragma once
+
+#ifndef ALIGNEDARRAY_HPP
+#define ALIGNEDARRAY_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <type_traits>
+
+/**
+ * Tableau dynamique de valeurs simples (copiables octet par octet) dont le début est
+ * aligné sur ALIGNMENT octets (une ligne de cache, assez pour AVX2 / AVX-512).
+ * Pas de constructeur par élément : les nouvelles valeurs sont mises à zéro.
+ * La capacité ne diminue jamais, resize sous la capacité ne réalloue pas.
+ */
+template <typename T, size_t ALIGNMENT = 64>
+class AlignedArray {
+    static_assert(std::is_trivially_copyable_v<T>, "AlignedArray : type copiable octet par octet seulement");
+
+public:
+    AlignedArray() = default;
+    ~AlignedArray() { release(); }
+
+    AlignedArray(const AlignedArray& other) { *this = other; }
+    AlignedArray& operator=(const AlignedArray& other) {
+        if (this != &other) {
+            resize(other.count);
+            if (count) std::memcpy(values, other.values, count * sizeof(T));
+        }
+        return *this;
+    }
+
+    AlignedArray(AlignedArray&& other) noexcept { swap(other); }
+    AlignedArray& operator=(AlignedArray&& other) noexcept {
+        if (this != &other) {
+            release();
+            swap(other);
+        }
+        return *this;
+    }
+
+    size_t size() const { return count; }
+    size_t capacity() const { return allocated; }
+    bool empty() const { return count == 0; }
+
+    T* data() { return values; }
+    const T* data() const { return values; }
+    T& operator[](size_t i) { return values[i]; }
+    const T& operator[](size_t i) const { return values[i]; }
+
+    T* begin() { return values; }
+    T* end() { return values + count; }
+    const T* begin() const { return values; }
+    const T* end() const { return values + count; }
+
+    void reserve(size_t wanted) {
+        if (wanted <= allocated) return;
+
+        T* grown = static_cast<T*>(::operator new(wanted * sizeof(T), std::align_val_t(ALIGNMENT)));
+        if (count) std::memcpy(grown, values, count * sizeof(T));
+        if (values) ::operator delete(values, std::align_val_t(ALIGNMENT));
+        values = grown;
+        allocated = wanted;
+    }
+
+    void resize(size_t wanted) {
+        if (wanted > allocated) reserve(std::max(wanted, allocated * 2));
+        if (wanted > count) std::memset(static_cast<void*>(values + count), 0, (wanted - count) * sizeof(T));
+        count = wanted;
+    }
+
+    // remplace le contenu par n valeurs copiées, sans la mise à zéro de resize
+    void assign(const T* source, size_t n) {
+        count = 0; // rien à recopier si reserve réalloue
+        reserve(n);
+        if (n) std::memcpy(static_cast<void*>(values), source, n * sizeof(T));
+        count = n;
+    }
+
+    void push_back(const T& value) {
+        resize(count + 1);
+        values[count - 1] = value;
+    }
+
+    void clear() { count = 0; }
+
+    void swap(AlignedArray& other) noexcept {
+        std::swap(values, other.values);
+        std::swap(count, other.count);
+        std::swap(allocated, other.allocated);
+    }
+
+private:
+    T* values = nullptr;
+    size_t count = 0;
+    size_t allocated = 0;
+
+    void release() {
+        if (values) ::operator delete(values, std::align_val_t(ALIGNMENT));
+        values = nullptr;
+        count = 0;
+        allocated = 0;
+    }
+};
+
+#endif // ALIGNEDARRAY_HPP
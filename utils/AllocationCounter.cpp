@@ -0,0 +1,40 @@
+#include "AllocationCounter.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+static std::atomic<uint64_t> allocations{0};
+
+uint64_t allocationCounter::count() {
+    return allocations.load(std::memory_order_relaxed);
+}
+
+void* operator new(std::size_t size) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+// aligned_alloc n'existe pas partout (MinGW) : bloc plus grand pris avec malloc,
+// l'adresse d'origine est rangée juste avant l'adresse alignée rendue
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    const std::size_t align = static_cast<std::size_t>(alignment);
+    void* raw = std::malloc(size + align + sizeof(void*));
+    if (!raw) throw std::bad_alloc();
+
+    std::uintptr_t aligned = (reinterpret_cast<std::uintptr_t>(raw) + sizeof(void*) + align - 1) & ~(align - 1);
+    reinterpret_cast<void**>(aligned)[-1] = raw;
+    return reinterpret_cast<void*>(aligned);
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+void operator delete(void* p, std::align_val_t) noexcept {
+    if (p) std::free(static_cast<void**>(p)[-1]);
+}
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept {
+    if (p) std::free(static_cast<void**>(p)[-1]);
+}
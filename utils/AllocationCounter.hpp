@@ -0,0 +1,19 @@
+#pragma once
+
+#ifndef ALLOCATIONCOUNTER_HPP
+#define ALLOCATIONCOUNTER_HPP
+
+#include <cstdint>
+
+/**
+ * Compte les allocations sur le tas de tout le programme : AllocationCounter.cpp remplace
+ * les operator new globaux (toutes les variantes passent par les deux versions remplacées).
+ * Sert à vérifier qu'un tick de simulation en régime établi n'alloue rien.
+ * À ne compiler que dans les programmes qui s'en servent (version headless).
+ */
+namespace allocationCounter {
+    // nombre d'allocations depuis le lancement
+    uint64_t count();
+}
+
+#endif // ALLOCATIONCOUNTER_HPP
@@ -4,8 +4,14 @@
 #include <numeric>
 #include <algorithm>
 #include <cmath>
+#include <mutex>
 
 #include "mathUtils.hpp"
+#include "Simd.hpp"
+
+#if SIMD_HAS_AVX2
+#include <immintrin.h>
+#endif
 
 /**
  * Perlin's improved fade
@@ -38,6 +44,31 @@ void Noise::initPerm(unsigned int seed) {
     perm.insert(perm.end(), perm.begin(), perm.end());
 }
 
+std::shared_ptr<const Noise> Noise::forSeed(unsigned int seed) {
+    static const size_t cacheSize = 8;
+    static std::mutex cacheMutex;
+    static std::vector<std::shared_ptr<const Noise>> cache; // la plus récente à la fin
+
+    std::lock_guard<std::mutex> lock(cacheMutex);
+
+    for (auto it = cache.begin(); it != cache.end(); ++it) {
+        if ((*it)->seed == seed) {
+            std::shared_ptr<const Noise> found = *it;
+            cache.erase(it);
+            cache.push_back(found);
+            return found;
+        }
+    }
+
+    auto created = std::make_shared<Noise>();
+    created->initPerm(seed);
+    cache.push_back(created);
+    if (cache.size() > cacheSize) {
+        cache.erase(cache.begin());
+    }
+    return created;
+}
+
 double Noise::noise(double x, double y) const {
     int xi = (int)std::floor(x) & 255;
     int yi = (int)std::floor(y) & 255;
@@ -98,7 +129,196 @@ unsigned int Noise::hash(unsigned int x) {
     return x;
 }
 
-float Noise::valueNoise(int q, int r) {
+float Noise::valueNoise(int q, int r) const {
     uint32_t h = hash(q * 374761393u + r * 668265263u + this->seed);
     return (h & 0xFFFFFF) / float(0xFFFFFF); // entre 0 et 1
+}
+
+/* ------------------------------------------------------------------------ */
+/* Versions grille (float)                                                  */
+/* ------------------------------------------------------------------------ */
+
+/**
+ * Même calcul que noise() mais en float, dans l'ordre exact des opérations
+ * du noyau AVX2 pour que les deux donnent des résultats identiques
+ */
+static inline float fadeF(float t) {
+    return t*t*t*(t*(t*6.0f - 15.0f) + 10.0f);
+}
+
+static inline float gradF(int hash, float x, float y) {
+    int h = hash & 15;
+    float u = h < 8 ? x : y;
+    float v = h < 4 ? y : (h == 12 || h == 14 ? x : 0.0f);
+    return (((h & 1) ? -u : u) + ((h & 2) ? -v : v));
+}
+
+static inline float noiseF(const int* perm, float x, float y) {
+    float fx = std::floor(x);
+    float fy = std::floor(y);
+    int xi = static_cast<int>(fx) & 255;
+    int yi = static_cast<int>(fy) & 255;
+
+    float xf = x - fx;
+    float yf = y - fy;
+
+    float u = fadeF(xf);
+    float v = fadeF(yf);
+
+    int aa = perm[perm[xi] + yi];
+    int ab = perm[perm[xi] + yi + 1];
+    int ba = perm[perm[xi + 1] + yi];
+    int bb = perm[perm[xi + 1] + yi + 1];
+
+    float x1 = MathUtils::lerp(gradF(aa, xf, yf), gradF(ba, xf - 1.0f, yf), u);
+    float x2 = MathUtils::lerp(gradF(ab, xf, yf - 1.0f), gradF(bb, xf - 1.0f, yf - 1.0f), u);
+    return MathUtils::lerp(x1, x2, v);
+}
+
+static void fractalNoiseScalar(const int* perm, const float* xs, const float* ys, float* out,
+                               size_t begin, size_t end, const NoiseParams& p) {
+    for (size_t i = begin; i < end; ++i) {
+        float x = p.scale * (p.offsetX + xs[i] * p.frequency);
+        float y = p.scale * (p.offsetY + ys[i] * p.frequency);
+
+        float sum = 0.0f;
+        float amplitude = 1.0f;
+        float frequency = 1.0f;
+        float maxAmp = 0.0f;
+
+        for (int o = 0; o < p.octaves; ++o) {
+            sum = sum + noiseF(perm, x * frequency, y * frequency) * amplitude;
+            maxAmp += amplitude;
+            amplitude *= p.persistence;
+            frequency *= p.lacunarity;
+        }
+        out[i] = 0.5f * (sum / (maxAmp + 1e-12f) + 1.0f);
+    }
+}
+
+#if SIMD_HAS_AVX2
+SIMD_TARGET_AVX2
+static inline __m256 fadeAvx2(__m256 t) {
+    __m256 r = _mm256_sub_ps(_mm256_mul_ps(t, _mm256_set1_ps(6.0f)), _mm256_set1_ps(15.0f));
+    r = _mm256_add_ps(_mm256_mul_ps(t, r), _mm256_set1_ps(10.0f));
+    return _mm256_mul_ps(_mm256_mul_ps(_mm256_mul_ps(t, t), t), r);
+}
+
+SIMD_TARGET_AVX2
+static inline __m256 gradAvx2(__m256i hash, __m256 x, __m256 y) {
+    const __m256i h = _mm256_and_si256(hash, _mm256_set1_epi32(15));
+    const __m256 signBit = _mm256_set1_ps(-0.0f);
+
+    // u = h < 8 ? x : y
+    __m256 hLt8 = _mm256_castsi256_ps(_mm256_cmpgt_epi32(_mm256_set1_epi32(8), h));
+    __m256 u = _mm256_blendv_ps(y, x, hLt8);
+
+    // v = h < 4 ? y : (h == 12 || h == 14 ? x : 0)
+    __m256 hLt4 = _mm256_castsi256_ps(_mm256_cmpgt_epi32(_mm256_set1_epi32(4), h));
+    __m256 h12or14 = _mm256_castsi256_ps(_mm256_or_si256(
+        _mm256_cmpeq_epi32(h, _mm256_set1_epi32(12)),
+        _mm256_cmpeq_epi32(h, _mm256_set1_epi32(14))
+    ));
+    __m256 v = _mm256_blendv_ps(_mm256_and_ps(h12or14, x), y, hLt4);
+
+    // changement de signe selon les bits 1 et 2
+    __m256 negU = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(h, _mm256_set1_epi32(1)), 31));
+    __m256 negV = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(h, _mm256_set1_epi32(2)), 30));
+    u = _mm256_xor_ps(u, _mm256_and_ps(negU, signBit));
+    v = _mm256_xor_ps(v, _mm256_and_ps(negV, signBit));
+    return _mm256_add_ps(u, v);
+}
+
+SIMD_TARGET_AVX2
+static inline __m256 lerpAvx2(__m256 a, __m256 b, __m256 t) {
+    return _mm256_add_ps(a, _mm256_mul_ps(_mm256_sub_ps(b, a), t));
+}
+
+SIMD_TARGET_AVX2
+static inline __m256 noiseAvx2(const int* perm, __m256 x, __m256 y) {
+    const __m256i mask = _mm256_set1_epi32(255);
+    const __m256i one = _mm256_set1_epi32(1);
+    const __m256 onef = _mm256_set1_ps(1.0f);
+
+    __m256 fx = _mm256_floor_ps(x);
+    __m256 fy = _mm256_floor_ps(y);
+    __m256i xi = _mm256_and_si256(_mm256_cvttps_epi32(fx), mask);
+    __m256i yi = _mm256_and_si256(_mm256_cvttps_epi32(fy), mask);
+
+    __m256 xf = _mm256_sub_ps(x, fx);
+    __m256 yf = _mm256_sub_ps(y, fy);
+
+    __m256 u = fadeAvx2(xf);
+    __m256 v = fadeAvx2(yf);
+
+    __m256i pA = _mm256_add_epi32(_mm256_i32gather_epi32(perm, xi, 4), yi);
+    __m256i pB = _mm256_add_epi32(_mm256_i32gather_epi32(perm, _mm256_add_epi32(xi, one), 4), yi);
+
+    __m256i aa = _mm256_i32gather_epi32(perm, pA, 4);
+    __m256i ab = _mm256_i32gather_epi32(perm, _mm256_add_epi32(pA, one), 4);
+    __m256i ba = _mm256_i32gather_epi32(perm, pB, 4);
+    __m256i bb = _mm256_i32gather_epi32(perm, _mm256_add_epi32(pB, one), 4);
+
+    __m256 xf1 = _mm256_sub_ps(xf, onef);
+    __m256 yf1 = _mm256_sub_ps(yf, onef);
+
+    __m256 x1 = lerpAvx2(gradAvx2(aa, xf, yf), gradAvx2(ba, xf1, yf), u);
+    __m256 x2 = lerpAvx2(gradAvx2(ab, xf, yf1), gradAvx2(bb, xf1, yf1), u);
+    return lerpAvx2(x1, x2, v);
+}
+
+SIMD_TARGET_AVX2
+static size_t fractalNoiseAvx2(const int* perm, const float* xs, const float* ys, float* out,
+                               size_t count, const NoiseParams& p) {
+    const __m256 scale = _mm256_set1_ps(p.scale);
+    const __m256 offsetX = _mm256_set1_ps(p.offsetX);
+    const __m256 offsetY = _mm256_set1_ps(p.offsetY);
+    const __m256 baseFrequency = _mm256_set1_ps(p.frequency);
+
+    size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256 x = _mm256_mul_ps(scale, _mm256_add_ps(offsetX, _mm256_mul_ps(_mm256_loadu_ps(xs + i), baseFrequency)));
+        __m256 y = _mm256_mul_ps(scale, _mm256_add_ps(offsetY, _mm256_mul_ps(_mm256_loadu_ps(ys + i), baseFrequency)));
+
+        __m256 sum = _mm256_setzero_ps();
+        float amplitude = 1.0f;
+        float frequency = 1.0f;
+        float maxAmp = 0.0f;
+
+        for (int o = 0; o < p.octaves; ++o) {
+            __m256 f = _mm256_set1_ps(frequency);
+            __m256 n = noiseAvx2(perm, _mm256_mul_ps(x, f), _mm256_mul_ps(y, f));
+            sum = _mm256_add_ps(sum, _mm256_mul_ps(n, _mm256_set1_ps(amplitude)));
+            maxAmp += amplitude;
+            amplitude *= p.persistence;
+            frequency *= p.lacunarity;
+        }
+
+        __m256 r = _mm256_div_ps(sum, _mm256_set1_ps(maxAmp + 1e-12f));
+        r = _mm256_mul_ps(_mm256_set1_ps(0.5f), _mm256_add_ps(r, _mm256_set1_ps(1.0f)));
+        _mm256_storeu_ps(out + i, r);
+    }
+    return i;
+}
+#endif
+
+void Noise::fractalNoiseGrid(const float* xs, const float* ys, float* out, size_t count, const NoiseParams& params) const {
+    size_t done = 0;
+#if SIMD_HAS_AVX2
+    if (simd::hasAvx2()) {
+        done = fractalNoiseAvx2(perm.data(), xs, ys, out, count, params);
+    }
+#endif
+    // reste (ou tout si pas d'AVX2)
+    fractalNoiseScalar(perm.data(), xs, ys, out, done, count, params);
+}
+
+void Noise::valueNoiseGrid(const float* xs, const float* ys, float* out, size_t count, const NoiseParams& params) const {
+    // même ordre d'opérations que l'ancien calcul par tile : la troncature en int
+    // amplifie le moindre écart d'arrondi (voir NoiseParams::frequencyMult)
+    for (size_t i = 0; i < count; ++i) {
+        int q = static_cast<int>((params.offsetX + xs[i] * params.frequency * params.frequencyMult) * params.scale);
+        int r = static_cast<int>((params.offsetY + ys[i] * params.frequency * params.frequencyMult) * params.scale);
+        out[i] = valueNoise(q, r);
+    }
 }
\ No newline at end of file
@@ -1,6 +1,23 @@
 #pragma once
 
 #include <vector>
+#include <memory>
+#include <cstddef>
+
+/**
+ * Paramètres d'un remplissage de grille :
+ * le point i est échantillonné en scale * (offset + coord[i] * frequency)
+ */
+struct NoiseParams {
+    float offsetX = 0.0f;
+    float offsetY = 0.0f;
+    float frequency = 1.0f;
+    float frequencyMult = 1.0f;  // value noise seulement : coord * frequency * frequencyMult
+    float scale = 1.0f;
+    int octaves = 1;
+    float persistence = 0.5f;
+    float lacunarity = 2.0f;
+};
 
 class Noise {
 public:
@@ -9,6 +26,16 @@ public:
 
     void initPerm(unsigned int seed);
 
+    /**
+     * Contexte de bruit partagé pour une seed : la table de permutation n'est construite
+     * qu'une fois puis gardée en cache (les dernières seeds utilisées), les régénérations
+     * qui ne changent pas la seed la réutilisent telle quelle.
+     * L'objet est en lecture seule, il peut être utilisé par plusieurs threads.
+     */
+    static std::shared_ptr<const Noise> forSeed(unsigned int seed);
+
+    unsigned int getSeed() const { return seed; }
+
     double noise(double x, double y) const;
     
     double fractalNoise(double x, double y, int octaves, double persistence, double lacunarity) const;
@@ -18,12 +45,25 @@ public:
      */
     double ridgedNoise(double x, double y, int octaves = 6, double lacunarity = 2.0, double gain = 0.5) const;
     
-    float valueNoise(int q, int r);
+    float valueNoise(int q, int r) const;
+
+    /**
+     * fractalNoise en float sur count points d'un coup (toute une carte)
+     * 8 points par instruction en AVX2, sinon version scalaire aux résultats identiques
+     */
+    void fractalNoiseGrid(const float* xs, const float* ys, float* out, size_t count, const NoiseParams& params) const;
+
+    /**
+     * valueNoise sur count points, coordonnées tronquées comme pour valueNoise(int, int)
+     * échantillonné en (offset + coord[i] * frequency * frequencyMult) * scale, dans cet ordre :
+     * la troncature en int rend le masque sensible au moindre arrondi
+     */
+    void valueNoiseGrid(const float* xs, const float* ys, float* out, size_t count, const NoiseParams& params) const;
 
 private:
-    unsigned int seed;
+    unsigned int seed = 0;
 
     std::vector<int> perm; // 512 entries
 
-    unsigned int hash(unsigned int x);
+    static unsigned int hash(unsigned int x);
 };
\ No newline at end of file
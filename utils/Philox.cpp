@@ -0,0 +1,114 @@
+#include "Philox.hpp"
+
+#include "Simd.hpp"
+
+#if SIMD_HAS_AVX2
+#include <immintrin.h>
+#endif
+
+// constantes de Philox4x32
+static constexpr uint32_t M0 = 0xD2511F53u;
+static constexpr uint32_t M1 = 0xCD9E8D57u;
+static constexpr uint32_t W0 = 0x9E3779B9u;
+static constexpr uint32_t W1 = 0xBB67AE85u;
+static constexpr int ROUNDS = 10;
+
+// le deuxième mot de clé sépare les usages, le numéro de bloc complète le compteur
+static uint32_t purposeKey(rng::Purpose purpose) {
+    return 0x85EBCA6Bu * (static_cast<uint32_t>(purpose) + 1);
+}
+
+std::array<uint32_t, 4> rng::philox(uint32_t seed, uint32_t id, uint32_t tick, Purpose purpose, uint32_t block) {
+    uint32_t c0 = id, c1 = tick, c2 = block, c3 = 0;
+    uint32_t k0 = seed, k1 = purposeKey(purpose);
+
+    for (int r = 0; r < ROUNDS; ++r) {
+        uint64_t p0 = static_cast<uint64_t>(M0) * c0;
+        uint64_t p1 = static_cast<uint64_t>(M1) * c2;
+        uint32_t hi0 = static_cast<uint32_t>(p0 >> 32), lo0 = static_cast<uint32_t>(p0);
+        uint32_t hi1 = static_cast<uint32_t>(p1 >> 32), lo1 = static_cast<uint32_t>(p1);
+
+        c0 = hi1 ^ c1 ^ k0;
+        c1 = lo1;
+        c2 = hi0 ^ c3 ^ k1;
+        c3 = lo0;
+
+        k0 += W0;
+        k1 += W1;
+    }
+    return {c0, c1, c2, c3};
+}
+
+static void uniformBatchScalar(uint32_t seed, const uint32_t* ids, int begin, int count, uint32_t tick,
+                               rng::Purpose purpose, float* const* outputs, int nbOutputs) {
+    for (int i = begin; i < count; ++i) {
+        std::array<uint32_t, 4> bits = rng::philox(seed, ids[i], tick, purpose);
+        for (int k = 0; k < nbOutputs; ++k) {
+            outputs[k][i] = rng::toUniform(bits[k]);
+        }
+    }
+}
+
+#if SIMD_HAS_AVX2
+// produits 32 x 32 -> 64 bits des 8 voies : moitiés basse et haute
+SIMD_TARGET_AVX2
+static inline void mulhiloAvx2(__m256i a, __m256i m, __m256i& hi, __m256i& lo) {
+    __m256i even = _mm256_mul_epu32(a, m);                         // voies 0, 2, 4, 6
+    __m256i odd = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), m);   // voies 1, 3, 5, 7
+    lo = _mm256_blend_epi32(even, _mm256_slli_epi64(odd, 32), 0xAA);
+    hi = _mm256_blend_epi32(_mm256_srli_epi64(even, 32), odd, 0xAA);
+}
+
+SIMD_TARGET_AVX2
+static inline __m256 toUniformAvx2(__m256i bits) {
+    return _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(bits, 8)), _mm256_set1_ps(1.0f / 16777216.0f));
+}
+
+SIMD_TARGET_AVX2
+static int uniformBatchAvx2(uint32_t seed, const uint32_t* ids, int count, uint32_t tick,
+                            rng::Purpose purpose, float* const* outputs, int nbOutputs) {
+    const __m256i m0 = _mm256_set1_epi32(static_cast<int>(M0));
+    const __m256i m1 = _mm256_set1_epi32(static_cast<int>(M1));
+
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256i c0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ids + i));
+        __m256i c1 = _mm256_set1_epi32(static_cast<int>(tick));
+        __m256i c2 = _mm256_setzero_si256();
+        __m256i c3 = _mm256_setzero_si256();
+        uint32_t k0 = seed, k1 = purposeKey(purpose);
+
+        for (int r = 0; r < ROUNDS; ++r) {
+            __m256i hi0, lo0, hi1, lo1;
+            mulhiloAvx2(c0, m0, hi0, lo0);
+            mulhiloAvx2(c2, m1, hi1, lo1);
+
+            c0 = _mm256_xor_si256(_mm256_xor_si256(hi1, c1), _mm256_set1_epi32(static_cast<int>(k0)));
+            c1 = lo1;
+            c2 = _mm256_xor_si256(_mm256_xor_si256(hi0, c3), _mm256_set1_epi32(static_cast<int>(k1)));
+            c3 = lo0;
+
+            k0 += W0;
+            k1 += W1;
+        }
+
+        const __m256i words[4] = {c0, c1, c2, c3};
+        for (int k = 0; k < nbOutputs; ++k) {
+            _mm256_storeu_ps(outputs[k] + i, toUniformAvx2(words[k]));
+        }
+    }
+    return i;
+}
+#endif
+
+void rng::uniformBatch(uint32_t seed, const uint32_t* ids, int count, uint32_t tick, Purpose purpose,
+                       float* const* outputs, int nbOutputs) {
+    int done = 0;
+#if SIMD_HAS_AVX2
+    if (simd::hasAvx2()) {
+        done = uniformBatchAvx2(seed, ids, count, tick, purpose, outputs, nbOutputs);
+    }
+#endif
+    // reste (ou tout si pas d'AVX2)
+    uniformBatchScalar(seed, ids, done, count, tick, purpose, outputs, nbOutputs);
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#ifndef PHILOX_HPP
+#define PHILOX_HPP
+
+#include <array>
+#include <cstdint>
+
+/**
+ * Générateur aléatoire sans état (Philox4x32-10, Salmon et al. 2011) :
+ * un tirage est une fonction pure de (seed, id de la créature, tick, usage, numéro du tirage).
+ * N'importe quel thread obtient les mêmes valeurs dans n'importe quel ordre, rien n'est
+ * partagé entre threads et une simulation rejouée retrouve exactement les mêmes tirages.
+ * Chaque appel à philox donne 4 mots de 32 bits : les tirages 0 à 3 d'un même
+ * (id, tick, usage) coûtent un seul calcul.
+ */
+namespace rng {
+    // usage d'un tirage : deux usages différents ne donnent jamais les mêmes valeurs
+    enum class Purpose : uint32_t {
+        Spawn,      // population de départ (régime, tile, âge)
+        Mutation,   // chance, caractéristique, ampleur
+        DietRoll,   // dé à 99 faces du choix de nourriture
+        Encounter,  // repérage, fuite, combat
+        Count
+    };
+
+    std::array<uint32_t, 4> philox(uint32_t seed, uint32_t id, uint32_t tick, Purpose purpose, uint32_t block = 0);
+
+    // 24 bits de poids fort -> [0, 1)
+    inline float toUniform(uint32_t bits) {
+        return static_cast<float>(bits >> 8) * (1.0f / 16777216.0f);
+    }
+
+    // tirage numéro draw dans [0, 1)
+    inline float uniform(uint32_t seed, uint32_t id, uint32_t tick, Purpose purpose, uint32_t draw = 0) {
+        return toUniform(philox(seed, id, tick, purpose, draw / 4)[draw % 4]);
+    }
+
+    // dé à 99 faces : 1 à 99
+    inline int d99(uint32_t seed, uint32_t id, uint32_t tick, Purpose purpose, uint32_t draw = 0) {
+        return 1 + static_cast<int>(uniform(seed, id, tick, purpose, draw) * 99.0f);
+    }
+
+    /**
+     * Tirages 0 à nbOutputs - 1 (nbOutputs <= 4) pour count créatures d'un coup :
+     * outputs[k][i] == uniform(seed, ids[i], tick, purpose, k).
+     * 8 créatures par instruction en AVX2, version scalaire aux résultats identiques.
+     */
+    void uniformBatch(uint32_t seed, const uint32_t* ids, int count, uint32_t tick, Purpose purpose,
+                      float* const* outputs, int nbOutputs);
+}
+
+#endif // PHILOX_HPP
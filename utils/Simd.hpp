@@ -0,0 +1,33 @@
+#pragma once
+
+#ifndef SIMD_HPP
+#define SIMD_HPP
+
+/**
+ * Aide pour les noyaux vectorisés :
+ * les fonctions AVX2 sont compilées à part (attribut target) et choisies à l'exécution,
+ * la version scalaire reste toujours disponible et donne les mêmes résultats.
+ */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    #define SIMD_HAS_AVX2 1
+    #define SIMD_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+    #define SIMD_HAS_AVX2 0
+    #define SIMD_TARGET_AVX2
+#endif
+
+namespace simd {
+    // permet de forcer les versions scalaires (debug, comparaison des résultats)
+    inline bool enabled = true;
+
+    inline bool hasAvx2() {
+#if SIMD_HAS_AVX2
+        static const bool supported = __builtin_cpu_supports("avx2");
+        return enabled && supported;
+#else
+        return false;
+#endif
+    }
+}
+
+#endif // SIMD_HPP
\ No newline at end of file
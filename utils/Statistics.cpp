@@ -0,0 +1,160 @@
+#include "Statistics.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+/* ----- RunningStats ----- */
+
+void RunningStats::add(float value) {
+    if (n == 0) {
+        minimum = value;
+        maximum = value;
+    } else {
+        minimum = std::min(minimum, value);
+        maximum = std::max(maximum, value);
+    }
+    n++;
+    double delta = value - average;
+    average += delta / n;
+    m2 += delta * (value - average);
+}
+
+void RunningStats::merge(const RunningStats& other) {
+    if (other.n == 0) return;
+    if (n == 0) {
+        *this = other;
+        return;
+    }
+    minimum = std::min(minimum, other.minimum);
+    maximum = std::max(maximum, other.maximum);
+
+    long long total = n + other.n;
+    double delta = other.average - average;
+    average += delta * other.n / total;
+    m2 += other.m2 + delta * delta * (static_cast<double>(n) * other.n / total);
+    n = total;
+}
+
+/* ----- TDigest ----- */
+
+static const double PI = 3.14159265358979323846;
+
+// fonction d'échelle k1 : un centroïde couvre au plus une unité de k
+static double scaleK(double q) {
+    return TDigest::COMPRESSION / (2.0 * PI) * std::asin(2.0 * q - 1.0);
+}
+
+static double scaleKInverse(double k) {
+    return (std::sin(k * 2.0 * PI / TDigest::COMPRESSION) + 1.0) / 2.0;
+}
+
+void TDigest::add(float value) {
+    if (count() == 0) {
+        minimum = value;
+        maximum = value;
+    } else {
+        minimum = std::min(minimum, value);
+        maximum = std::max(maximum, value);
+    }
+
+    buffer[nbBuffered++] = value;
+    if (nbBuffered == BUFFER_SIZE) flush();
+}
+
+void TDigest::merge(const TDigest& other) {
+    if (other.count() == 0) return;
+
+    if (count() == 0) {
+        minimum = other.minimum;
+        maximum = other.maximum;
+    } else {
+        minimum = std::min(minimum, other.minimum);
+        maximum = std::max(maximum, other.maximum);
+    }
+
+    // centroïdes de other + son buffer (poids 1) ajoutés par paquets de BUFFER_SIZE
+    std::array<Centroid, MAX_CENTROIDS + BUFFER_SIZE> extra;
+    int nbExtra = 0;
+    for (int i = 0; i < other.nbCentroids; ++i) extra[nbExtra++] = other.centroids[i];
+    for (int i = 0; i < other.nbBuffered; ++i) extra[nbExtra++] = Centroid{other.buffer[i], 1.0};
+
+    compress(extra.data(), nbExtra);
+}
+
+long long TDigest::count() const {
+    return static_cast<long long>(totalWeight) + nbBuffered;
+}
+
+void TDigest::compress(const Centroid* extra, int nbExtra) {
+    // tout ce qu'il faut fusionner, trié par moyenne
+    std::array<Centroid, MAX_CENTROIDS + 2 * BUFFER_SIZE + MAX_CENTROIDS> all;
+    int nbAll = 0;
+    for (int i = 0; i < nbCentroids; ++i) all[nbAll++] = centroids[i];
+    for (int i = 0; i < nbBuffered; ++i) all[nbAll++] = Centroid{buffer[i], 1.0};
+    for (int i = 0; i < nbExtra; ++i) all[nbAll++] = extra[i];
+    nbBuffered = 0;
+    if (nbAll == 0) return;
+
+    std::stable_sort(all.begin(), all.begin() + nbAll, [](const Centroid& a, const Centroid& b) {
+        return a.mean < b.mean;
+    });
+
+    double total = 0.0;
+    for (int i = 0; i < nbAll; ++i) total += all[i].weight;
+
+    // un centroïde grossit tant que son poids cumulé reste sous la limite donnée par k1
+    nbCentroids = 0;
+    Centroid current = all[0];
+    double weightBefore = 0.0;
+    double limit = total * scaleKInverse(scaleK(0.0) + 1.0);
+
+    for (int i = 1; i < nbAll; ++i) {
+        if (weightBefore + current.weight + all[i].weight <= limit) {
+            double weight = current.weight + all[i].weight;
+            current.mean += (all[i].mean - current.mean) * all[i].weight / weight;
+            current.weight = weight;
+        } else {
+            weightBefore += current.weight;
+            centroids[nbCentroids++] = current;
+            current = all[i];
+            limit = total * scaleKInverse(scaleK(weightBefore / total) + 1.0);
+
+            // jamais atteint avec k1 (au plus COMPRESSION centroïdes), garde-fou pour le tableau fixe
+            if (nbCentroids == MAX_CENTROIDS - 1) limit = total;
+        }
+    }
+    centroids[nbCentroids++] = current;
+    totalWeight = total;
+}
+
+float TDigest::quantile(float q) const {
+    if (count() == 0) return 0.0f;
+    if (nbBuffered > 0) {
+        TDigest flushed = *this;
+        flushed.flush();
+        return flushed.quantile(q);
+    }
+
+    q = std::clamp(q, 0.0f, 1.0f);
+    const double target = q * totalWeight;
+
+    // chaque centroïde est centré sur sa moyenne : interpolation entre centres voisins,
+    // les extrémités sont ancrées sur le minimum et le maximum exacts
+    double cumulative = 0.0;
+    double previousCenter = 0.0;
+    double previousMean = minimum;
+    for (int i = 0; i < nbCentroids; ++i) {
+        const Centroid& c = centroids[i];
+        double center = cumulative + c.weight / 2.0;
+        if (target < center) {
+            double t = (center > previousCenter) ? (target - previousCenter) / (center - previousCenter) : 0.0;
+            return static_cast<float>(previousMean + t * (c.mean - previousMean));
+        }
+        cumulative += c.weight;
+        previousCenter = center;
+        previousMean = c.mean;
+    }
+
+    double t = (totalWeight > previousCenter) ? (target - previousCenter) / (totalWeight - previousCenter) : 1.0;
+    return static_cast<float>(previousMean + t * (maximum - previousMean));
+}
\ No newline at end of file
@@ -0,0 +1,123 @@
+#pragma once
+
+#ifndef STATISTICS_HPP
+#define STATISTICS_HPP
+
+#include <array>
+#include <cstddef>
+
+/**
+ * Statistiques en flux : chaque valeur est vue une seule fois, sans copie ni allocation
+ * (tailles fixes). Tous les accumulateurs peuvent être fusionnés : chaque bloc de la
+ * génération remplit les siens puis ils sont fusionnés dans l'ordre des blocs, le résultat
+ * ne dépend donc pas du nombre de threads.
+ */
+
+// nombre, minimum, maximum, moyenne et variance (Welford, fusion de Chan et al.)
+class RunningStats {
+public:
+    void add(float value);
+    void merge(const RunningStats& other);
+
+    long long count() const { return n; }
+    float min() const { return n ? minimum : 0.0f; }
+    float max() const { return n ? maximum : 0.0f; }
+    float mean() const { return n ? static_cast<float>(average) : 0.0f; }
+    // variance de la population, 0 si aucune valeur
+    float variance() const { return n ? static_cast<float>(m2 / n) : 0.0f; }
+
+private:
+    long long n = 0;
+    float minimum = 0.0f;
+    float maximum = 0.0f;
+    double average = 0.0;
+    double m2 = 0.0; // somme des carrés des écarts à la moyenne
+};
+
+/**
+ * Quantiles approchés (t-digest à taille fixe) : les valeurs sont regroupées en centroïdes,
+ * petits vers les extrémités et gros vers la médiane, l'erreur est donc faible sur les
+ * quantiles extrêmes comme sur la médiane.
+ */
+class TDigest {
+public:
+    static constexpr int COMPRESSION = 100;
+    static constexpr int MAX_CENTROIDS = 2 * COMPRESSION;
+    static constexpr int BUFFER_SIZE = 256;
+
+    void add(float value);
+    void merge(const TDigest& other);
+
+    // q dans [0, 1], 0 si aucune valeur
+    float quantile(float q) const;
+    long long count() const;
+
+private:
+    struct Centroid {
+        double mean;
+        double weight;
+    };
+
+    std::array<Centroid, MAX_CENTROIDS> centroids;
+    int nbCentroids = 0;
+    double totalWeight = 0.0; // poids des centroïdes (sans le buffer)
+
+    std::array<float, BUFFER_SIZE> buffer;
+    int nbBuffered = 0;
+
+    float minimum = 0.0f;
+    float maximum = 0.0f;
+
+    // fusionne le buffer et extra (centroïdes triés ou non) dans les centroïdes
+    void compress(const Centroid* extra, int nbExtra);
+    void flush() { compress(nullptr, 0); }
+};
+
+// histogramme à NB_BINS classes de même largeur sur [low, high], les valeurs hors de l'intervalle
+// sont comptées dans la première ou la dernière classe
+template <int NB_BINS>
+class Histogram {
+public:
+    Histogram(float low = 0.0f, float high = 1.0f) : low(low), high(high) {}
+
+    void add(float value) {
+        int bin = static_cast<int>((value - low) / (high - low) * NB_BINS);
+        if (bin < 0) bin = 0;
+        if (bin >= NB_BINS) bin = NB_BINS - 1;
+        bins[bin]++;
+    }
+
+    void merge(const Histogram& other) {
+        for (int i = 0; i < NB_BINS; ++i) bins[i] += other.bins[i];
+    }
+
+    static constexpr int size() { return NB_BINS; }
+    int operator[](int bin) const { return bins[bin]; }
+    float binLow(int bin) const { return low + (high - low) * bin / NB_BINS; }
+    float rangeLow() const { return low; }
+    float rangeHigh() const { return high; }
+
+private:
+    float low;
+    float high;
+    std::array<int, NB_BINS> bins{};
+};
+
+// compteur indexé par un identifiant (enum) de 0 à N - 1
+template <int N>
+class IdCounter {
+public:
+    void add(int id) { counts[id]++; }
+
+    void merge(const IdCounter& other) {
+        for (int i = 0; i < N; ++i) counts[i] += other.counts[i];
+    }
+
+    static constexpr int size() { return N; }
+    int operator[](int id) const { return counts[id]; }
+
+private:
+    std::array<int, N> counts{};
+};
+
+#endif // STATISTICS_HPP
\ No newline at end of file
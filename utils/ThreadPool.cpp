@@ -0,0 +1,102 @@
+#include "ThreadPool.hpp"
+
+#include <algorithm>
+
+ThreadPool::ThreadPool(int nbThreads) {
+    if (nbThreads <= 0) {
+        nbThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    // le thread appelant compte comme un des threads
+    for (int i = 1; i < nbThreads; ++i) {
+        workers.emplace_back(&ThreadPool::workerLoop, this);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wakeUp.notify_all();
+
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+}
+
+void ThreadPool::parallelFor(int count, int blockSize, const std::function<void(int begin, int end)>& task) {
+    if (count <= 0) return;
+    blockSize = std::max(1, blockSize);
+    int nbBlocks = (count + blockSize - 1) / blockSize;
+
+    // pas de threads ou un seul bloc : pas la peine de réveiller qui que ce soit
+    if (workers.empty() || nbBlocks == 1) {
+        for (int begin = 0; begin < count; begin += blockSize) {
+            task(begin, std::min(count, begin + blockSize));
+        }
+        return;
+    }
+
+    Job job;
+    job.task = &task;
+    job.count = count;
+    job.blockSize = blockSize;
+    job.nbBlocks = nbBlocks;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        currentJob = &job;
+        ++jobId;
+    }
+    wakeUp.notify_all();
+
+    runBlocks(job);
+
+    // barrière : tous les blocs finis et plus aucun thread ne lit le travail en cours
+    std::unique_lock<std::mutex> lock(mutex);
+    finished.wait(lock, [&] { return job.blocksDone == job.nbBlocks && activeWorkers == 0; });
+    currentJob = nullptr;
+}
+
+void ThreadPool::workerLoop() {
+    unsigned int lastJob = 0;
+
+    while (true) {
+        Job* job = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wakeUp.wait(lock, [&] { return stopping || jobId != lastJob; });
+            if (stopping) return;
+            lastJob = jobId;
+
+            // réveillé trop tard : le travail est déjà terminé
+            if (!currentJob) continue;
+            job = currentJob;
+            ++activeWorkers;
+        }
+
+        runBlocks(*job);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            --activeWorkers;
+        }
+        finished.notify_all();
+    }
+}
+
+void ThreadPool::runBlocks(Job& job) {
+    int done = 0;
+
+    for (int block = job.nextBlock++; block < job.nbBlocks; block = job.nextBlock++) {
+        int begin = block * job.blockSize;
+        (*job.task)(begin, std::min(job.count, begin + job.blockSize));
+        ++done;
+    }
+
+    if (done > 0) {
+        std::lock_guard<std::mutex> lock(mutex);
+        job.blocksDone += done;
+    }
+}
\ No newline at end of file
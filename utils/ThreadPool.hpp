@@ -0,0 +1,60 @@
+#pragma once
+
+#ifndef THREADPOOL_HPP
+#define THREADPOOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * Pool de threads minimal pour les étapes parallèles de la génération.
+ * parallelFor découpe [0, count) en blocs de taille fixe, les distribue aux threads
+ * (le thread appelant travaille aussi) et ne rend la main qu'une fois tous les blocs
+ * terminés : chaque appel sert donc de barrière entre deux étapes.
+ * Le découpage ne dépend pas du nombre de threads, seulement de blockSize.
+ * Un seul parallelFor à la fois par pool (pas d'appel imbriqué depuis une tâche).
+ */
+class ThreadPool {
+public:
+    // nbThreads <= 0 : un thread par coeur
+    explicit ThreadPool(int nbThreads = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // nombre total de threads qui exécutent les blocs (appelant compris)
+    int size() const { return static_cast<int>(workers.size()) + 1; }
+
+    void parallelFor(int count, int blockSize, const std::function<void(int begin, int end)>& task);
+
+private:
+    // un appel à parallelFor en cours (vit sur la pile de l'appelant)
+    struct Job {
+        const std::function<void(int, int)>* task;
+        int count;
+        int blockSize;
+        int nbBlocks;
+        std::atomic<int> nextBlock{0};
+        int blocksDone = 0;
+    };
+
+    std::vector<std::thread> workers;
+
+    std::mutex mutex;
+    std::condition_variable wakeUp;
+    std::condition_variable finished;
+    bool stopping = false;
+    unsigned int jobId = 0;
+    Job* currentJob = nullptr;
+    int activeWorkers = 0; // threads qui travaillent sur currentJob
+
+    void workerLoop();
+    void runBlocks(Job& job);
+};
+
+#endif // THREADPOOL_HPP
\ No newline at end of file